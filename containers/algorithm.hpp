@@ -2,6 +2,7 @@
 #define ALGORITHM_HPP
 
 // #include "vector.hpp"
+#include <cstddef> // std::ptrdiff_t
 namespace ft
 {
 // swap
@@ -68,6 +69,32 @@ namespace ft
         }
         return (first2 != last2);
     }
+// merge_sort
+    // stable sort of the array [first, last),
+    // buf must hold at least (last - first) constructed elements, they are used as scratch
+    template <class T, class Compare>
+    void merge_sort(T *first, T *last, T *buf, Compare comp)
+    {
+        std::ptrdiff_t n = last - first;
+        if (n < 2)
+            return ;
+        T *mid = first + n / 2;
+        merge_sort(first, mid, buf, comp);
+        merge_sort(mid, last, buf, comp);
+        if (!comp(*mid, *(mid - 1))) // halves already in order
+            return ;
+        T *a = first;
+        T *b = mid;
+        T *out = buf;
+        while (a != mid && b != last)
+            *out++ = comp(*b, *a) ? *b++ : *a++; // equal keys : left half first
+        while (a != mid)
+            *out++ = *a++;
+        while (b != last)
+            *out++ = *b++;
+        for (T *p = buf; p != out; )
+            *first++ = *p++;
+    }
 }
 	
 #endif
@@ -0,0 +1,923 @@
+#ifndef BTREE_HPP
+#define BTREE_HPP
+
+#include <cstddef> // std::size_t
+#include <functional> // std::less
+#include <memory>
+#include <new> // placement new
+#include "type_trait.hpp"
+#include "pair.hpp"
+#include "btree_iterator.hpp"
+#include "reverse_iterator.hpp"
+#include "algorithm.hpp"
+
+namespace ft
+{
+    // raw room for N objects of type T, aligned for any scalar type, constructed one by one
+    template <typename T, std::size_t N>
+    union btree_slots
+    {
+        char        _buf[sizeof(T) * N];
+        long double _align_ld;
+        void        *_align_ptr;
+
+        T *ptr()
+        {
+            return reinterpret_cast<T *>(_buf);
+        }
+        const T *ptr() const
+        {
+            return reinterpret_cast<const T *>(_buf);
+        }
+    };
+
+    // leaves hold the values, sorted, and are chained in key order
+    template <typename T, std::size_t N>
+    struct btree_leaf
+    {
+        typedef T   value_type;
+
+        std::size_t         _count;
+        btree_leaf          *_prev;
+        btree_leaf          *_next;
+        btree_slots<T, N>   _slots;
+
+        T *values()
+        {
+            return _slots.ptr();
+        }
+        const T *values() const
+        {
+            return _slots.ptr();
+        }
+    };
+
+    // inner nodes only route : _count keys and _count + 1 children,
+    // keys of child i are in [key i - 1, key i)
+    template <typename Key, std::size_t N>
+    struct btree_inner
+    {
+        std::size_t         _count;
+        void                *_child[N + 1];   // leaves or inner nodes, depending on the level
+        btree_slots<Key, N> _slots;
+
+        Key *keys()
+        {
+            return _slots.ptr();
+        }
+        const Key *keys() const
+        {
+            return _slots.ptr();
+        }
+    };
+
+    /**
+     * @brief B+ tree
+     * Same role as ft::rbtree (unique keys only) for btree_map / btree_set.
+     * Nodes are about 256 bytes : a lookup reads a few contiguous nodes instead of
+     * ~log2(n) scattered ones, and a leaf stores values with no per-value links.
+     * Every insertion and erasure may move values between slots :
+     * all iterators are invalidated.
+     */
+    template <typename Key,
+            typename Val,
+            typename KeyOfValue,
+            typename Compare = std::less<Key>,
+            typename Alloc = std::allocator<Val>
+            >
+    class btree
+    {
+        public:
+            // Member types
+            typedef Key                 key_type;
+            typedef Val                 value_type;
+            typedef Alloc               allocator_type;
+            typedef Compare             key_compare;
+            typedef std::size_t         size_type;
+
+        private:
+            // node sizes : 4 cache lines, at least 4 slots
+            static const size_type _node_bytes = 256;
+            static const size_type _leaf_fit = (_node_bytes - 3 * sizeof(void *)) / sizeof(Val);
+            static const size_type _inner_fit = (_node_bytes - 2 * sizeof(void *)) / (sizeof(Key) + sizeof(void *));
+
+        public:
+            // a node is split as soon as it is full : at most slots - 1 entries between two operations
+            static const size_type leaf_slots = _leaf_fit < 4 ? 4 : _leaf_fit;
+            static const size_type inner_slots = _inner_fit < 4 ? 4 : _inner_fit;
+
+            typedef btree_leaf<value_type, leaf_slots>      leaf_type;
+            typedef btree_inner<key_type, inner_slots>      inner_type;
+            typedef leaf_type                               *leaf_ptr;
+            typedef inner_type                              *inner_ptr;
+
+            typedef ft::btree_iterator<leaf_type, value_type>           iterator;
+            typedef ft::btree_iterator<leaf_type, const value_type>     const_iterator;
+            typedef ft::reverse_iterator<iterator>                      reverse_iterator;
+            typedef ft::reverse_iterator<const_iterator>                const_reverse_iterator;
+
+        private:
+            typedef typename allocator_type::template rebind<leaf_type>::other  leaf_allocator_type;
+            typedef typename allocator_type::template rebind<inner_type>::other inner_allocator_type;
+
+        // Member variables
+            leaf_allocator_type     _leaf_alloc;
+            inner_allocator_type    _inner_alloc;
+            void                    *_root;     // a leaf when _height == 0, NULL when empty
+            size_type               _height;    // number of inner levels
+            leaf_ptr                _first;     // begin()
+            leaf_ptr                _last;      // end() lives in its one-past-the-last slot
+            key_compare             _comp;
+            size_type               _size;
+
+        public:
+            // Constructor
+            explicit btree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _leaf_alloc(alloc), _inner_alloc(alloc), _root(NULL), _height(0), _first(NULL), _last(NULL),
+              _comp(comp), _size(0)
+            {}
+            // Copy constructor : structural clone, O(n) without any comparison
+            btree(const btree &x)
+            : _leaf_alloc(x._leaf_alloc), _inner_alloc(x._inner_alloc), _root(NULL), _height(0), _first(NULL), _last(NULL),
+              _comp(x._comp), _size(0)
+            {
+                _copy_from(x);
+            }
+            btree &operator=(const btree &x)
+            {
+                if (this != &x)
+                {
+                    this->clear();
+                    _comp = x._comp;
+                    _copy_from(x);
+                }
+                return *this;
+            }
+            ~btree()
+            {
+                this->clear();
+            }
+
+            // Iterator
+            iterator begin() const
+            {
+                return iterator(_first, 0);
+            }
+            iterator end() const
+            {
+                return _last ? iterator(_last, _last->_count) : iterator();
+            }
+
+            size_type size() const
+            {
+                return _size;
+            }
+            size_type max_size() const
+            {
+                size_type n = allocator_type(_leaf_alloc).max_size();
+                return (n < PTRDIFF_MAX) ? n : PTRDIFF_MAX;
+            }
+            allocator_type get_allocator() const
+            {
+                return allocator_type(_leaf_alloc);
+            }
+            key_compare key_comp() const
+            {
+                return _comp;
+            }
+            void swap(btree &x)
+            {
+                ft::swap(_leaf_alloc, x._leaf_alloc);
+                ft::swap(_inner_alloc, x._inner_alloc);
+                ft::swap(_root, x._root);
+                ft::swap(_height, x._height);
+                ft::swap(_first, x._first);
+                ft::swap(_last, x._last);
+                ft::swap(_comp, x._comp);
+                ft::swap(_size, x._size);
+            }
+            void clear()
+            {
+                if (_root)
+                    _destroy(_root, _height);
+                _root = NULL;
+                _height = 0;
+                _first = NULL;
+                _last = NULL;
+                _size = 0;
+            }
+
+            // Lookup : any K the comparator accepts next to key_type (see is_transparent)
+                // first value whose key is not less than key (end() if none)
+            template <typename K>
+            iterator _lower_bound(const K &key) const
+            {
+                if (_root == NULL)
+                    return end();
+                leaf_ptr leaf = _find_leaf(key);
+                return _make_iter(leaf, _leaf_lower(leaf, key));
+            }
+                // first value whose key is greater than key (end() if none)
+            template <typename K>
+            iterator _upper_bound(const K &key) const
+            {
+                if (_root == NULL)
+                    return end();
+                leaf_ptr leaf = _find_leaf(key);
+                return _make_iter(leaf, _leaf_upper(leaf, key));
+            }
+            template <typename K>
+            ft::pair<iterator, iterator> _equal_range(const K &key) const
+            {
+                iterator first = _lower_bound(key);
+
+                if (first == end() || _comp(key, KeyOfValue()(*first)))
+                    return ft::pair<iterator, iterator>(first, first);
+                iterator last = first;
+                return ft::pair<iterator, iterator>(first, ++last);
+            }
+                // value holding key, end() if none
+            template <typename K>
+            iterator _find_key(const K &key) const
+            {
+                if (_root == NULL)
+                    return end();
+                // key can only be in the leaf the separators lead to
+                leaf_ptr leaf = _find_leaf(key);
+                size_type i = _leaf_lower(leaf, key);
+                if (i == leaf->_count || _comp(key, KeyOfValue()(leaf->values()[i])))
+                    return end();
+                return iterator(leaf, i);
+            }
+
+            // Modifiers
+                // insert only if no value with an equivalent key exists
+            ft::pair<iterator, bool> _insert_unique(const value_type &data)
+            {
+                return _find_or_insert(KeyOfValue()(data), _value_ref(data));
+            }
+                // one descent for key : returns the value holding it, or inserts make() there.
+                // make() (anything returning a value_type) is only called on a miss,
+                // e.g. btree_map::operator[] builds its default mapped_type only then.
+                // (no parent links : the slot found at the leaf can't be handed back and
+                // filled later like rbtree::_find_unique_pos, the splits need the descent's stack)
+            template <typename Make>
+            ft::pair<iterator, bool> _find_or_insert(const key_type &key, const Make &make)
+            {
+                if (_root == NULL)
+                {
+                    leaf_ptr leaf = _new_leaf();
+                    try
+                    {
+                        _leaf_insert(leaf, 0, make());
+                    }
+                    catch (...)
+                    {
+                        _leaf_alloc.deallocate(leaf, 1);
+                        throw;
+                    }
+                    _root = leaf;
+                    _first = leaf;
+                    _last = leaf;
+                    _size = 1;
+                    return ft::pair<iterator, bool>(iterator(leaf, 0), true);
+                }
+
+                iterator pos;
+                bool inserted = false;
+                // appending after the maximum : full nodes are split at their end,
+                // so sorted input leaves every node full instead of half full
+                bool append = _comp(KeyOfValue()(_last->values()[_last->_count - 1]), key);
+                void *right = _insert(_root, _height, key, make, append, pos, inserted);
+
+                if (right)
+                {
+                    // root split : the tree grows by one level
+                    inner_ptr root = _new_inner();
+                    root->_child[0] = _root;
+                    _inner_insert(root, 0, _first_key(right, _height), right);
+                    _root = root;
+                    ++_height;
+                }
+                if (inserted)
+                    ++_size;
+                return ft::pair<iterator, bool>(pos, inserted);
+            }
+            template <typename InputIterator>
+            void _insert_range_unique(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                    _insert_unique(*first);
+            }
+            template <typename K>
+            size_type _erase_unique(const K &key)
+            {
+                if (_root == NULL || !_erase(_root, _height, key))
+                    return 0;
+                --_size;
+                _shrink_root();
+                return 1;
+            }
+            void _erase(iterator position)
+            {
+                // the key is read before its value is destroyed, and not after
+                _erase_unique(KeyOfValue()(*position));
+            }
+                // erase [first, last) one leaf at a time : the run of slots it holds goes in one shift,
+                // its parent is fixed once, and the next leaf is found again from the last erased key
+                // (values move on every erase) : O(k / leaf_slots * log n) for k values
+            void _erase_range(iterator first, iterator last)
+            {
+                if (first == begin() && last == end())
+                {
+                    this->clear();
+                    return ;
+                }
+                size_type n = _distance(first, last);
+                while (n > 0)
+                {
+                    key_type key = KeyOfValue()(*first);
+                    size_type erased = _erase_run(_root, _height, key, n);
+                    _size -= erased;
+                    n -= erased;
+                    _shrink_root();
+                    if (n > 0)
+                        first = _lower_bound(key);
+                }
+            }
+
+        private:
+            // Private member functions
+                // nodes
+            leaf_ptr _new_leaf()
+            {
+                leaf_ptr x = _leaf_alloc.allocate(1);
+                x->_count = 0;
+                x->_prev = NULL;
+                x->_next = NULL;
+                return x;
+            }
+            inner_ptr _new_inner()
+            {
+                inner_ptr x = _inner_alloc.allocate(1);
+                x->_count = 0;
+                return x;
+            }
+            void _destroy(void *x, size_type level)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr leaf = static_cast<leaf_ptr>(x);
+                    for (size_type i = 0; i < leaf->_count; ++i)
+                        _destroy_value(leaf->values() + i);
+                    _leaf_alloc.deallocate(leaf, 1);
+                    return ;
+                }
+                inner_ptr node = static_cast<inner_ptr>(x);
+                for (size_type i = 0; i <= node->_count; ++i)
+                    _destroy(node->_child[i], level - 1);
+                for (size_type i = 0; i < node->_count; ++i)
+                    node->keys()[i].~key_type();
+                _inner_alloc.deallocate(node, 1);
+            }
+            void _construct_value(value_type *p, const value_type &val)
+            {
+                allocator_type(_leaf_alloc).construct(p, val);
+            }
+            void _destroy_value(value_type *p)
+            {
+                allocator_type(_leaf_alloc).destroy(p);
+            }
+                // separators are plain copies of keys
+            void _set_key(inner_ptr node, size_type i, const key_type &key)
+            {
+                key_type *p = node->keys() + i;
+                if (p != &key)
+                {
+                    p->~key_type();
+                    new (static_cast<void *>(p)) key_type(key);
+                }
+            }
+            static size_type _count_of(void *x, size_type level)
+            {
+                return level == 0 ? static_cast<leaf_ptr>(x)->_count : static_cast<inner_ptr>(x)->_count;
+            }
+            static size_type _min_count(size_type level)
+            {
+                return level == 0 ? (leaf_slots - 1) / 2 : (inner_slots - 1) / 2;
+            }
+                // smallest key of the subtree x : a valid separator in front of it
+            const key_type &_first_key(void *x, size_type level) const
+            {
+                for (; level > 0; --level)
+                    x = static_cast<inner_ptr>(x)->_child[0];
+                return KeyOfValue()(static_cast<leaf_ptr>(x)->values()[0]);
+            }
+
+                // search
+            template <typename K>
+            size_type _leaf_lower(const leaf_type *leaf, const K &key) const
+            {
+                const value_type *v = leaf->values();
+                size_type lo = 0;
+                size_type n = leaf->_count;
+
+                while (n > 0)
+                {
+                    size_type half = n / 2;
+                    if (_comp(KeyOfValue()(v[lo + half]), key))
+                    {
+                        lo += half + 1;
+                        n -= half + 1;
+                    }
+                    else
+                        n = half;
+                }
+                return lo;
+            }
+            template <typename K>
+            size_type _leaf_upper(const leaf_type *leaf, const K &key) const
+            {
+                const value_type *v = leaf->values();
+                size_type lo = 0;
+                size_type n = leaf->_count;
+
+                while (n > 0)
+                {
+                    size_type half = n / 2;
+                    if (!_comp(key, KeyOfValue()(v[lo + half])))
+                    {
+                        lo += half + 1;
+                        n -= half + 1;
+                    }
+                    else
+                        n = half;
+                }
+                return lo;
+            }
+                // child whose key range holds key : number of separators not greater than key
+            template <typename K>
+            size_type _child_index(const inner_type *node, const K &key) const
+            {
+                const key_type *k = node->keys();
+                size_type lo = 0;
+                size_type n = node->_count;
+
+                while (n > 0)
+                {
+                    size_type half = n / 2;
+                    if (!_comp(key, k[lo + half]))
+                    {
+                        lo += half + 1;
+                        n -= half + 1;
+                    }
+                    else
+                        n = half;
+                }
+                return lo;
+            }
+            template <typename K>
+            leaf_ptr _find_leaf(const K &key) const
+            {
+                void *x = _root;
+
+                for (size_type level = _height; level > 0; --level)
+                {
+                    inner_ptr node = static_cast<inner_ptr>(x);
+                    x = node->_child[_child_index(node, key)];
+                }
+                return static_cast<leaf_ptr>(x);
+            }
+                // one past the last slot of a leaf is the first slot of the next one
+            iterator _make_iter(leaf_ptr leaf, size_type i) const
+            {
+                if (i == leaf->_count && leaf->_next)
+                    return iterator(leaf->_next, 0);
+                return iterator(leaf, i);
+            }
+
+                // slot shifting : values may have a const key, they are copied and destroyed, never assigned
+            void _leaf_insert(leaf_ptr leaf, size_type i, const value_type &val)
+            {
+                value_type *v = leaf->values();
+
+                for (size_type j = leaf->_count; j > i; --j)
+                {
+                    _construct_value(v + j, v[j - 1]);
+                    _destroy_value(v + j - 1);
+                }
+                try
+                {
+                    _construct_value(v + i, val);
+                }
+                catch (...)
+                {
+                    for (size_type j = i; j < leaf->_count; ++j)
+                    {
+                        _construct_value(v + j, v[j + 1]);
+                        _destroy_value(v + j + 1);
+                    }
+                    throw;
+                }
+                ++leaf->_count;
+            }
+                // slots [i, i + n)
+            void _leaf_erase(leaf_ptr leaf, size_type i, size_type n = 1)
+            {
+                value_type *v = leaf->values();
+
+                for (size_type j = i; j < i + n; ++j)
+                    _destroy_value(v + j);
+                for (size_type j = i + n; j < leaf->_count; ++j)
+                {
+                    _construct_value(v + j - n, v[j]);
+                    _destroy_value(v + j);
+                }
+                leaf->_count -= n;
+            }
+                // moves src[from, from + n) to the end of dst
+            void _leaf_move(leaf_ptr dst, leaf_ptr src, size_type from, size_type n)
+            {
+                value_type *d = dst->values() + dst->_count;
+                value_type *s = src->values() + from;
+
+                for (size_type j = 0; j < n; ++j)
+                {
+                    _construct_value(d + j, s[j]);
+                    _destroy_value(s + j);
+                }
+                dst->_count += n;
+                for (size_type j = from + n; j < src->_count; ++j)
+                {
+                    _construct_value(src->values() + j - n, src->values()[j]);
+                    _destroy_value(src->values() + j);
+                }
+                src->_count -= n;
+            }
+                // key i and child i + 1
+            void _inner_insert(inner_ptr node, size_type i, const key_type &key, void *child)
+            {
+                key_type *k = node->keys();
+
+                for (size_type j = node->_count; j > i; --j)
+                {
+                    new (static_cast<void *>(k + j)) key_type(k[j - 1]);
+                    k[j - 1].~key_type();
+                    node->_child[j + 1] = node->_child[j];
+                }
+                new (static_cast<void *>(k + i)) key_type(key);
+                node->_child[i + 1] = child;
+                ++node->_count;
+            }
+                // key i and child i + 1
+            void _inner_erase(inner_ptr node, size_type i)
+            {
+                key_type *k = node->keys();
+
+                k[i].~key_type();
+                for (size_type j = i + 1; j < node->_count; ++j)
+                {
+                    new (static_cast<void *>(k + j - 1)) key_type(k[j]);
+                    k[j].~key_type();
+                    node->_child[j] = node->_child[j + 1];
+                }
+                --node->_count;
+            }
+                // moves keys [from, count) and children (from, count] of src to the end of dst
+            void _inner_move(inner_ptr dst, inner_ptr src, size_type from)
+            {
+                key_type *d = dst->keys();
+                key_type *s = src->keys();
+                size_type n = src->_count - from;
+
+                for (size_type j = 0; j < n; ++j)
+                {
+                    new (static_cast<void *>(d + dst->_count + j)) key_type(s[from + j]);
+                    s[from + j].~key_type();
+                    dst->_child[dst->_count + j + 1] = src->_child[from + j + 1];
+                }
+                dst->_count += n;
+                src->_count = from;
+            }
+
+                // insertion
+                    // _insert_unique's value source : the value is already there
+            struct _value_ref
+            {
+                const value_type &_v;
+                explicit _value_ref(const value_type &v) : _v(v) {}
+                const value_type &operator()() const { return _v; }
+            };
+                // inserts make() below x (level 0 : x is a leaf) unless key is there, pos receives its position.
+                // when x fills up it is split and the new right sibling is returned, NULL otherwise
+            template <typename Make>
+            void *_insert(void *x, size_type level, const key_type &key, const Make &make, bool append, iterator &pos, bool &inserted)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr leaf = static_cast<leaf_ptr>(x);
+                    size_type i = _leaf_lower(leaf, key);
+
+                    if (i != leaf->_count && !_comp(key, KeyOfValue()(leaf->values()[i])))
+                    {
+                        pos = iterator(leaf, i);
+                        return NULL;
+                    }
+                    _leaf_insert(leaf, i, make());
+                    inserted = true;
+                    if (leaf->_count < leaf_slots)
+                    {
+                        pos = iterator(leaf, i);
+                        return NULL;
+                    }
+                    return _split_leaf(leaf, i, append, pos);
+                }
+                inner_ptr node = static_cast<inner_ptr>(x);
+                size_type j = _child_index(node, key);
+                void *right = _insert(node->_child[j], level - 1, key, make, append, pos, inserted);
+
+                if (right == NULL)
+                    return NULL;
+                _inner_insert(node, j, _first_key(right, level - 1), right);
+                if (node->_count < inner_slots)
+                    return NULL;
+                return _split_inner(node, append);
+            }
+                // a full leaf keeps its lower half, i is the slot of the value just inserted
+            leaf_ptr _split_leaf(leaf_ptr leaf, size_type i, bool append, iterator &pos)
+            {
+                leaf_ptr right = _new_leaf();
+                size_type mid = append ? leaf->_count - 1 : leaf->_count / 2;
+
+                _leaf_move(right, leaf, mid, leaf->_count - mid);
+                right->_prev = leaf;
+                right->_next = leaf->_next;
+                if (leaf->_next)
+                    leaf->_next->_prev = right;
+                else
+                    _last = right;
+                leaf->_next = right;
+                pos = (i < mid) ? iterator(leaf, i) : iterator(right, i - mid);
+                return right;
+            }
+                // a full inner node keeps keys [0, mid), key mid is dropped
+                // (the parent takes the smallest key of the right part instead)
+            inner_ptr _split_inner(inner_ptr node, bool append)
+            {
+                inner_ptr right = _new_inner();
+                size_type mid = append ? node->_count - 2 : node->_count / 2;
+
+                right->_child[0] = node->_child[mid + 1];
+                _inner_move(right, node, mid + 1);
+                node->keys()[mid].~key_type();
+                node->_count = mid;
+                return right;
+            }
+
+                // erasure
+                // erases key below x, underfull children are fixed on the way back up.
+                // key may live in the erased value : it is not read after the erase
+            template <typename K>
+            bool _erase(void *x, size_type level, const K &key)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr leaf = static_cast<leaf_ptr>(x);
+                    size_type i = _leaf_lower(leaf, key);
+
+                    if (i == leaf->_count || _comp(key, KeyOfValue()(leaf->values()[i])))
+                        return false;
+                    _leaf_erase(leaf, i);
+                    return true;
+                }
+                inner_ptr node = static_cast<inner_ptr>(x);
+                size_type j = _child_index(node, key);
+
+                if (!_erase(node->_child[j], level - 1, key))
+                    return false;
+                if (_count_of(node->_child[j], level - 1) < _min_count(level - 1))
+                    _rebalance(node, j, level - 1);
+                return true;
+            }
+                // erases up to n values from key on, in the leaf holding key : returns how many
+            template <typename K>
+            size_type _erase_run(void *x, size_type level, const K &key, size_type n)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr leaf = static_cast<leaf_ptr>(x);
+                    size_type i = _leaf_lower(leaf, key);
+
+                    if (n > leaf->_count - i)
+                        n = leaf->_count - i;
+                    _leaf_erase(leaf, i, n);
+                    return n;
+                }
+                inner_ptr node = static_cast<inner_ptr>(x);
+                size_type j = _child_index(node, key);
+
+                n = _erase_run(node->_child[j], level - 1, key, n);
+                if (_count_of(node->_child[j], level - 1) < _min_count(level - 1))
+                    _rebalance(node, j, level - 1);
+                return n;
+            }
+                // number of values in [first, last), one hop per leaf
+            static size_type _distance(iterator first, iterator last)
+            {
+                size_type n = 0;
+
+                for (; first._leaf != last._leaf; first = iterator(first._leaf->_next, 0))
+                    n += first._leaf->_count - first._pos;
+                return n + last._pos - first._pos;
+            }
+                // child j of node is underfull : borrow entries from a sibling that can spare them
+                // (a range erase may leave it several short), or merge with a sibling (both together fit in one node)
+            void _rebalance(inner_ptr node, size_type j, size_type level)
+            {
+                while (_count_of(node->_child[j], level) < _min_count(level))
+                {
+                    if (j > 0 && _count_of(node->_child[j - 1], level) > _min_count(level))
+                        _borrow_left(node, j, level);
+                    else if (j < node->_count && _count_of(node->_child[j + 1], level) > _min_count(level))
+                        _borrow_right(node, j, level);
+                    else
+                    {
+                        if (j > 0)
+                            _merge(node, j - 1, level);
+                        else
+                            _merge(node, j, level);
+                        return ;
+                    }
+                }
+            }
+            void _borrow_left(inner_ptr node, size_type j, size_type level)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr left = static_cast<leaf_ptr>(node->_child[j - 1]);
+                    leaf_ptr child = static_cast<leaf_ptr>(node->_child[j]);
+
+                    _leaf_insert(child, 0, left->values()[left->_count - 1]);
+                    _leaf_erase(left, left->_count - 1);
+                    _set_key(node, j - 1, KeyOfValue()(child->values()[0]));
+                    return ;
+                }
+                inner_ptr left = static_cast<inner_ptr>(node->_child[j - 1]);
+                inner_ptr child = static_cast<inner_ptr>(node->_child[j]);
+
+                // the separator comes down in front of child, left's last key goes up
+                _inner_insert(child, 0, node->keys()[j - 1], child->_child[0]);
+                child->_child[0] = left->_child[left->_count];
+                _set_key(node, j - 1, left->keys()[left->_count - 1]);
+                left->keys()[left->_count - 1].~key_type();
+                --left->_count;
+            }
+            void _borrow_right(inner_ptr node, size_type j, size_type level)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr child = static_cast<leaf_ptr>(node->_child[j]);
+                    leaf_ptr right = static_cast<leaf_ptr>(node->_child[j + 1]);
+
+                    _leaf_insert(child, child->_count, right->values()[0]);
+                    _leaf_erase(right, 0);
+                    _set_key(node, j, KeyOfValue()(right->values()[0]));
+                    return ;
+                }
+                inner_ptr child = static_cast<inner_ptr>(node->_child[j]);
+                inner_ptr right = static_cast<inner_ptr>(node->_child[j + 1]);
+
+                // the separator comes down at the end of child, right's first key goes up
+                _inner_insert(child, child->_count, node->keys()[j], right->_child[0]);
+                _set_key(node, j, right->keys()[0]);
+                right->_child[0] = right->_child[1];
+                _inner_erase(right, 0);
+            }
+                // child i + 1 of node is appended to child i and freed
+            void _merge(inner_ptr node, size_type i, size_type level)
+            {
+                if (level == 0)
+                {
+                    leaf_ptr left = static_cast<leaf_ptr>(node->_child[i]);
+                    leaf_ptr right = static_cast<leaf_ptr>(node->_child[i + 1]);
+
+                    _leaf_move(left, right, 0, right->_count);
+                    left->_next = right->_next;
+                    if (right->_next)
+                        right->_next->_prev = left;
+                    else
+                        _last = left;
+                    _leaf_alloc.deallocate(right, 1);
+                }
+                else
+                {
+                    inner_ptr left = static_cast<inner_ptr>(node->_child[i]);
+                    inner_ptr right = static_cast<inner_ptr>(node->_child[i + 1]);
+
+                    _inner_insert(left, left->_count, node->keys()[i], right->_child[0]);
+                    _inner_move(left, right, 0);
+                    _inner_alloc.deallocate(right, 1);
+                }
+                _inner_erase(node, i);
+            }
+                // an erase leaves at most the root empty
+            void _shrink_root()
+            {
+                if (_height > 0)
+                {
+                    inner_ptr root = static_cast<inner_ptr>(_root);
+                    if (root->_count == 0)
+                    {
+                        _root = root->_child[0];
+                        --_height;
+                        _inner_alloc.deallocate(root, 1);
+                    }
+                }
+                else if (static_cast<leaf_ptr>(_root)->_count == 0)
+                {
+                    _leaf_alloc.deallocate(static_cast<leaf_ptr>(_root), 1);
+                    _root = NULL;
+                    _first = NULL;
+                    _last = NULL;
+                }
+            }
+
+                // copy : if a value copy throws, the partial clone is freed and the tree stays empty
+            void _copy_from(const btree &x)
+            {
+                if (x._root == NULL)
+                    return ;
+                leaf_ptr prev = NULL;
+                try
+                {
+                    _root = _clone(x._root, x._height, prev);
+                }
+                catch (...)
+                {
+                    _root = NULL;
+                    _first = NULL;
+                    _last = NULL;
+                    throw;
+                }
+                _last = prev;
+                _height = x._height;
+                _size = x._size;
+            }
+                // prev : last leaf cloned so far, the new leaves are chained to it.
+                // on a throw, every node built at this level and below is freed before rethrowing
+            void *_clone(const void *x, size_type level, leaf_ptr &prev)
+            {
+                if (level == 0)
+                {
+                    const leaf_type *src = static_cast<const leaf_type *>(x);
+                    leaf_ptr leaf = _new_leaf();
+
+                    try
+                    {
+                        for (size_type i = 0; i < src->_count; ++i)
+                        {
+                            _construct_value(leaf->values() + i, src->values()[i]);
+                            ++leaf->_count;
+                        }
+                    }
+                    catch (...)
+                    {
+                        _destroy(leaf, 0);
+                        throw;
+                    }
+                    leaf->_prev = prev;
+                    if (prev)
+                        prev->_next = leaf;
+                    else
+                        _first = leaf;
+                    prev = leaf;
+                    return leaf;
+                }
+                const inner_type *src = static_cast<const inner_type *>(x);
+                inner_ptr node = _new_inner();
+                size_type children = 0;
+                size_type keys = 0;
+
+                try
+                {
+                    for (; children <= src->_count; ++children)
+                        node->_child[children] = _clone(src->_child[children], level - 1, prev);
+                    for (; keys < src->_count; ++keys)
+                        new (static_cast<void *>(node->keys() + keys)) key_type(src->keys()[keys]);
+                }
+                catch (...)
+                {
+                    for (size_type i = 0; i < children; ++i)
+                        _destroy(node->_child[i], level - 1);
+                    for (size_type i = 0; i < keys; ++i)
+                        node->keys()[i].~key_type();
+                    _inner_alloc.deallocate(node, 1);
+                    throw;
+                }
+                node->_count = src->_count;
+                return node;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef BTREE_ITERATOR_HPP
+#define BTREE_ITERATOR_HPP
+
+#include "iterator_base.hpp"
+#include <cstddef> // std::ptrdiff_t, std::size_t
+
+namespace ft
+{
+    /**
+     * @brief btree iterator
+     * A leaf and a slot in it. Leaves are chained in key order, so stepping is
+     * a slot increment and, once per leaf, one pointer hop.
+     * end() is one past the last slot of the last leaf, (NULL, 0) for an empty tree.
+     * @tparam Leaf btree_leaf
+     * @tparam T value_type (iterator) or const value_type (const_iterator)
+     */
+    template <typename Leaf, typename T>
+    class btree_iterator
+    {
+        public:
+            typedef ft::bidirectional_iterator_tag      iterator_category;
+            typedef std::ptrdiff_t                      difference_type;
+            typedef typename Leaf::value_type           value_type;
+            typedef T                                   *pointer;
+            typedef T                                   &reference;
+            typedef btree_iterator<Leaf, T>             _Self;
+
+        // Member variables
+            Leaf        *_leaf;
+            std::size_t _pos;
+
+        // Member functions
+            btree_iterator()
+            : _leaf(NULL), _pos(0)
+            {}
+
+            btree_iterator(Leaf *leaf, std::size_t pos)
+            : _leaf(leaf), _pos(pos)
+            {}
+
+            template <typename U>   // iterator -> const_iterator only
+            btree_iterator(const btree_iterator<Leaf, U> &x)
+            : _leaf(x._leaf), _pos(x._pos)
+            {
+                pointer check = static_cast<U *>(NULL);
+                (void)check;
+            }
+
+            reference operator*() const
+            {
+                return _leaf->values()[_pos];
+            }
+            pointer operator->() const
+            {
+                return _leaf->values() + _pos;
+            }
+
+            _Self &operator++()
+            {
+                // the last leaf keeps end() in its one-past-the-last slot
+                if (++_pos == _leaf->_count && _leaf->_next)
+                {
+                    _leaf = _leaf->_next;
+                    _pos = 0;
+                }
+                return *this;
+            }
+            _Self operator++(int)
+            {
+                _Self temp(*this);
+                ++(*this);
+                return temp;
+            }
+            _Self &operator--()
+            {
+                if (_pos == 0)
+                {
+                    _leaf = _leaf->_prev;
+                    _pos = _leaf->_count;
+                }
+                --_pos;
+                return *this;
+            }
+            _Self operator--(int)
+            {
+                _Self temp(*this);
+                --(*this);
+                return temp;
+            }
+
+            template <typename U>
+            bool operator==(const btree_iterator<Leaf, U> &x) const
+            {
+                return _leaf == x._leaf && _pos == x._pos;
+            }
+            template <typename U>
+            bool operator!=(const btree_iterator<Leaf, U> &x) const
+            {
+                return !(*this == x);
+            }
+    };
+}
+
+#endif
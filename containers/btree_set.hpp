@@ -0,0 +1,292 @@
+#ifndef BTREE_SET_HPP
+#define BTREE_SET_HPP
+
+#include <functional>
+#include <memory>
+#include <cstddef>
+#include "btree.hpp"
+#include "set.hpp"      // _Single
+#include "pair.hpp"
+#include "type_trait.hpp"
+#include "reverse_iterator.hpp"
+#include "algorithm.hpp"
+
+namespace ft
+{
+    /**
+     * @brief btree_set
+     * Same interface as ft::set on a B+ tree (see btree.hpp),
+     * every insert and erase invalidates all iterators.
+     */
+    template < class T,                  // btree_set::key_type/value_type
+    class Compare = std::less<T>,        // btree_set::key_compare/value_compare
+    class Alloc = std::allocator<T> >    // btree_set::allocator_type
+    class btree_set
+    {
+        public:
+            // Member types
+            typedef T                                     key_type;
+            typedef T                                     value_type;
+
+            typedef ptrdiff_t difference_type;
+            typedef size_t  size_type;
+
+            typedef Compare     key_compare;
+            typedef Compare     value_compare;
+            typedef Alloc       allocator_type;
+
+            typedef typename allocator_type::reference	        reference;
+            typedef typename allocator_type::const_reference	const_reference;
+            typedef typename allocator_type::pointer            pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+
+        protected:
+            typedef btree<key_type, value_type, _Single<value_type>, key_compare, allocator_type> tree_type;
+
+        public:
+            typedef typename tree_type::const_iterator              iterator;
+            typedef typename tree_type::const_iterator              const_iterator;
+            typedef typename ft::reverse_iterator<iterator>         reverse_iterator;
+            typedef typename ft::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+        private:
+            tree_type   _tree;
+
+        public:
+            // Constructor
+            explicit btree_set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+            {}
+            template <class InputIt>
+            btree_set(InputIt first, InputIt last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+            {
+                _tree._insert_range_unique(first, last);
+            }
+                // Copy constructor
+            btree_set(const btree_set &x)
+            : _tree(x._tree)
+            {}
+                // Destructor
+            ~btree_set()
+            {}
+            // Operator=
+            btree_set &operator=(const btree_set &x)
+            {
+                if (this != &x)
+                    _tree = x._tree;
+                return *this;
+            }
+            // Member functions
+                // begin()
+            iterator begin() const
+            {
+                return _tree.begin();
+            }
+                // end()
+            iterator end() const
+            {
+                return _tree.end();
+            }
+                // rbegin()
+            reverse_iterator rbegin() const
+            {
+                return reverse_iterator(end());
+            }
+                // rend()
+            reverse_iterator rend() const
+            {
+                return reverse_iterator(begin());
+            }
+                // empty
+            bool empty() const
+            {
+                return (_tree.size() == 0);
+            }
+                // size
+            size_type size() const
+            {
+                return _tree.size();
+            }
+                // max_size
+            size_type max_size() const
+            {
+                return _tree.max_size();
+            }
+
+            // Modifiers:
+                // insert
+                    //single element (1)
+            ft::pair<iterator, bool> insert(const value_type &val)
+            {
+                ft::pair<typename tree_type::iterator, bool> ret = _tree._insert_unique(val);
+                return ft::pair<iterator, bool>(ret.first, ret.second);
+            }
+                    // with hint (2) : the hint is not used, see btree_map
+            iterator insert(iterator position, const value_type &val)
+            {
+                (void)position;
+                return _tree._insert_unique(val).first;
+            }
+                    //range (3)
+            template <class InputIterator>
+            void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+            {
+                _tree._insert_range_unique(first, last);
+            }
+                // erase
+                    // (1)
+            void erase(iterator position)
+            {
+                _tree._erase_unique(*position);
+            }
+                    // (2)
+            size_type erase(const key_type &k)
+            {
+                return _tree._erase_unique(k);
+            }
+                    // (3)
+            void erase(iterator first, iterator last)
+            {
+                _tree._erase_range(_mutable(first), _mutable(last));
+            }
+                // swap
+            void swap(btree_set &x)
+            {
+                _tree.swap(x._tree);
+            }
+                // clear
+            void clear()
+            {
+                _tree.clear();
+            }
+
+            // Observers
+                // key_comp
+            key_compare key_comp() const
+            {
+                return _tree.key_comp();
+            }
+                //value_comp
+            value_compare value_comp() const
+            {
+                return _tree.key_comp();
+            }
+
+            // Operation
+                    // same heterogeneous lookup rules as set
+                // find
+            iterator find(const key_type &k) const
+            {
+                return _tree._find_key(k);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            find(const K &k) const
+            {
+                return _tree._find_key(k);
+            }
+                // count
+            size_type count(const key_type &k) const
+            {
+                return (_tree._find_key(k) != _tree.end() ? 1 : 0);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            count(const K &k) const
+            {
+                return (_tree._find_key(k) != _tree.end() ? 1 : 0);
+            }
+                //lower_bound
+            iterator lower_bound(const key_type &k) const
+            {
+                return _tree._lower_bound(k);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            lower_bound(const K &k) const
+            {
+                return _tree._lower_bound(k);
+            }
+                // upper_bound
+            iterator upper_bound(const key_type &k) const
+            {
+                return _tree._upper_bound(k);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            upper_bound(const K &k) const
+            {
+                return _tree._upper_bound(k);
+            }
+                // equal_range
+            ft::pair<iterator, iterator> equal_range(const key_type &k) const
+            {
+                ft::pair<typename tree_type::iterator, typename tree_type::iterator> range = _tree._equal_range(k);
+                return ft::pair<iterator, iterator>(range.first, range.second);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<iterator, iterator> >::type
+            equal_range(const K &k) const
+            {
+                ft::pair<typename tree_type::iterator, typename tree_type::iterator> range = _tree._equal_range(k);
+                return ft::pair<iterator, iterator>(range.first, range.second);
+            }
+
+            // Allocator
+            allocator_type get_allocator() const
+            {
+                return _tree.get_allocator();
+            }
+
+        private:
+            static typename tree_type::iterator _mutable(const_iterator it)
+            {
+                return typename tree_type::iterator(it._leaf, it._pos);
+            }
+    };
+
+    // Non-member function overloads
+    template <class T, class Compare, class Alloc>
+    inline bool operator==(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator!=(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator<(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator>(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator<=(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator>=(const btree_set<T, Compare, Alloc> &lhs, const btree_set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    void swap(btree_set<T, Compare, Alloc> &x, btree_set<T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+}
+#endif
@@ -0,0 +1,595 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <cstddef>
+#include "vector.hpp"
+#include "pair.hpp"
+#include "type_trait.hpp"
+#include "algorithm.hpp"
+#include "reverse_iterator.hpp"
+#include "flat_map_iterator.hpp"
+
+namespace ft
+{
+    // tag : the range is already sorted by key and has no equivalent keys
+    struct sorted_unique_t {};
+    static const sorted_unique_t sorted_unique = sorted_unique_t();
+
+    /**
+     * @brief flat_map
+     * Same interface as ft::map, the elements live in two sorted ft::vector,
+     * one for the keys and one for the mapped values.
+     * Lookups are binary searches over contiguous keys (no pointer chasing),
+     * insert and erase shift the tail of both arrays : O(n).
+     * Iterators are invalidated by every insertion and erasure.
+     */
+    template <typename Key,                                        // flat_map::key_type
+              typename T,                                          // flat_map::mapped_type
+              typename Compare = std::less<Key>,                   // flat_map::key_compare
+              typename Alloc = std::allocator<ft::pair<const Key, T> > // flat_map::allocator_type
+              >
+    class flat_map
+    {
+        public:
+            // Member types
+            typedef Key                                     key_type;
+            typedef T                                       mapped_type;
+            typedef ft::pair<const key_type, mapped_type>   value_type;
+
+            typedef ptrdiff_t difference_type;
+            typedef size_t  size_type;
+
+            typedef Compare     key_compare;
+            typedef Alloc       allocator_type;
+
+            typedef ft::vector<key_type, typename allocator_type::template rebind<key_type>::other>         key_container_type;
+            typedef ft::vector<mapped_type, typename allocator_type::template rebind<mapped_type>::other>   mapped_container_type;
+
+            typedef ft::flat_map_iterator<key_type, mapped_type, mapped_type>       iterator;
+            typedef ft::flat_map_iterator<key_type, mapped_type, const mapped_type> const_iterator;
+            typedef typename ft::reverse_iterator<iterator>                         reverse_iterator;
+            typedef typename ft::reverse_iterator<const_iterator>                   const_reverse_iterator;
+
+            // no value_type is stored : references are proxies (see flat_map_reference)
+            typedef typename iterator::reference            reference;
+            typedef typename const_iterator::reference      const_reference;
+
+            class value_compare
+            {
+                friend class flat_map;
+
+                protected :
+                    Compare _comp;
+                    value_compare(Compare c)
+                    : _comp(c)
+                    {}
+                public :
+                    typedef bool		result_type;
+                    typedef value_type	first_argument_type;
+                    typedef value_type	second_argument_type;
+                    bool operator()( const value_type& lhs, const value_type& rhs ) const
+                    {
+                        return _comp(lhs.first, rhs.first);
+                    }
+            };
+
+        private:
+            // range inserts go through a sortable copy of the input
+            typedef ft::pair<key_type, mapped_type>         _entry;
+            typedef ft::vector<_entry, typename allocator_type::template rebind<_entry>::other> _entry_vector;
+
+            struct _entry_less
+            {
+                key_compare _comp;
+                _entry_less(const key_compare &c) : _comp(c) {}
+                bool operator()(const _entry &a, const _entry &b) const
+                {
+                    return _comp(a.first, b.first);
+                }
+            };
+
+            key_container_type      _keys;
+            mapped_container_type   _values;
+            key_compare             _comp;
+
+        public:
+            // Constructor
+            explicit flat_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _values(alloc), _comp(comp)
+            {}
+                // range : sorted input is taken in one pass, anything else is stable sorted first,
+                // the first of several equivalent keys wins (like map)
+            template <class InputIt>
+            flat_map(InputIt first, InputIt last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _values(alloc), _comp(comp)
+            {
+                _insert_range(first, last);
+            }
+                // sorted_unique : [first, last) is trusted to be sorted without duplicates, no comparison at all
+            template <class InputIt>
+            flat_map(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _values(alloc), _comp(comp)
+            {
+                for (; first != last; ++first)
+                {
+                    _keys.push_back((*first).first);
+                    _values.push_back((*first).second);
+                }
+            }
+                // sorted_unique : adopts ready made key and mapped arrays (same size)
+            flat_map(sorted_unique_t, const key_container_type &keys, const mapped_container_type &values, const key_compare &comp = key_compare())
+            : _keys(keys), _values(values), _comp(comp)
+            {}
+                // Copy constructor
+            flat_map(const flat_map &x)
+            : _keys(x._keys), _values(x._values), _comp(x._comp)
+            {}
+                // Destructor
+            ~flat_map()
+            {}
+            // Operator=
+            flat_map &operator=(const flat_map &x)
+            {
+                if (this != &x)
+                {
+                    _keys = x._keys;
+                    _values = x._values;
+                    _comp = x._comp;
+                }
+                return *this;
+            }
+            // Member functions
+                // begin()
+            iterator begin()
+            {
+                return _iter(0);
+            }
+            const_iterator begin() const
+            {
+                return _iter(0);
+            }
+                // end()
+            iterator end()
+            {
+                return _iter(size());
+            }
+            const_iterator end() const
+            {
+                return _iter(size());
+            }
+                // rbegin()
+            reverse_iterator rbegin()
+            {
+                return reverse_iterator(end());
+            }
+            const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator(end());
+            }
+                // rend()
+            reverse_iterator rend()
+            {
+                return reverse_iterator(begin());
+            }
+            const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator(begin());
+            }
+                // empty
+            bool empty() const
+            {
+                return _keys.empty();
+            }
+                // size
+            size_type size() const
+            {
+                return _keys.size();
+            }
+                // max_size
+            size_type max_size() const
+            {
+                return _keys.max_size() < _values.max_size() ? _keys.max_size() : _values.max_size();
+            }
+            // Element access:
+                // operation[]
+            mapped_type &operator[](const key_type &k)
+            {
+                size_type i = _lower_index(k);
+
+                if (i == size() || _comp(k, _keys[i]))
+                    _insert_at(i, k, mapped_type());
+                return _values[i];
+            }
+                // the two sorted arrays
+            const key_container_type &keys() const
+            {
+                return _keys;
+            }
+            const mapped_container_type &values() const
+            {
+                return _values;
+            }
+
+            // Modifiers:
+                // insert
+                    //single element (1)
+            ft::pair<iterator, bool> insert(const value_type &val)
+            {
+                size_type i = _lower_index(val.first);
+
+                if (i != size() && !_comp(val.first, _keys[i]))
+                    return ft::make_pair(_iter(i), false);
+                _insert_at(i, val.first, val.second);
+                return ft::make_pair(_iter(i), true);
+            }
+                    // with hint (2) : no search when val belongs right before position
+            iterator insert(iterator position, const value_type &val)
+            {
+                size_type i = position._key - _key_ptr();
+
+                if ((i == size() || _comp(val.first, _keys[i])) && (i == 0 || _comp(_keys[i - 1], val.first)))
+                {
+                    _insert_at(i, val.first, val.second);
+                    return _iter(i);
+                }
+                return insert(val).first;
+            }
+                    //range (3)
+            template <class InputIterator>
+            void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+            {
+                _insert_range(first, last);
+            }
+                // erase
+                    // (1)
+            void erase(iterator position)
+            {
+                size_type i = position._key - _key_ptr();
+
+                _keys.erase(_keys.begin() + i);
+                _values.erase(_values.begin() + i);
+            }
+                    // (2)
+            size_type erase(const key_type &k)
+            {
+                size_type i = _lower_index(k);
+
+                if (i == size() || _comp(k, _keys[i]))
+                    return 0;
+                _keys.erase(_keys.begin() + i);
+                _values.erase(_values.begin() + i);
+                return 1;
+            }
+                    // (3)
+            void erase(iterator first, iterator last)
+            {
+                size_type i = first._key - _key_ptr();
+                size_type j = last._key - _key_ptr();
+
+                _keys.erase(_keys.begin() + i, _keys.begin() + j);
+                _values.erase(_values.begin() + i, _values.begin() + j);
+            }
+                // swap
+            void swap(flat_map &x)
+            {
+                _keys.swap(x._keys);
+                _values.swap(x._values);
+                ft::swap(_comp, x._comp);
+            }
+                // clear
+            void clear()
+            {
+                _keys.clear();
+                _values.clear();
+            }
+
+            // Observers
+                // key_comp
+            key_compare key_comp() const
+            {
+                return _comp;
+            }
+                //value_comp
+            value_compare value_comp() const
+            {
+                return value_compare(_comp);
+            }
+
+            // Operation
+                    // lookups are templated on K for transparent comparators (see map),
+                    // key_type lookups resolve to the same code
+                // find
+            iterator find(const key_type &k)
+            {
+                return _iter(_find_index(k));
+            }
+            const_iterator find(const key_type &k) const
+            {
+                return _iter(_find_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            find(const K &k)
+            {
+                return _iter(_find_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            find(const K &k) const
+            {
+                return _iter(_find_index(k));
+            }
+                // count
+            size_type count(const key_type &k) const
+            {
+                return (_find_index(k) != size() ? 1 : 0);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            count(const K &k) const
+            {
+                return (_find_index(k) != size() ? 1 : 0);
+            }
+                //lower_bound
+            iterator lower_bound(const key_type &k)
+            {
+                return _iter(_lower_index(k));
+            }
+            const_iterator lower_bound(const key_type &k) const
+            {
+                return _iter(_lower_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            lower_bound(const K &k)
+            {
+                return _iter(_lower_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            lower_bound(const K &k) const
+            {
+                return _iter(_lower_index(k));
+            }
+                // upper_bound
+            iterator upper_bound(const key_type &k)
+            {
+                return _iter(_upper_index(k));
+            }
+            const_iterator upper_bound(const key_type &k) const
+            {
+                return _iter(_upper_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            upper_bound(const K &k)
+            {
+                return _iter(_upper_index(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            upper_bound(const K &k) const
+            {
+                return _iter(_upper_index(k));
+            }
+                // equal_range
+            ft::pair<iterator, iterator> equal_range(const key_type &k)
+            {
+                size_type i = _lower_index(k);
+                return ft::pair<iterator, iterator>(_iter(i), _iter(_equal_end(i, k)));
+            }
+            ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+            {
+                size_type i = _lower_index(k);
+                return ft::pair<const_iterator, const_iterator>(_iter(i), _iter(_equal_end(i, k)));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<iterator, iterator> >::type
+            equal_range(const K &k)
+            {
+                size_type i = _lower_index(k);
+                return ft::pair<iterator, iterator>(_iter(i), _iter(_equal_end(i, k)));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<const_iterator, const_iterator> >::type
+            equal_range(const K &k) const
+            {
+                size_type i = _lower_index(k);
+                return ft::pair<const_iterator, const_iterator>(_iter(i), _iter(_equal_end(i, k)));
+            }
+
+            // Allocator
+            allocator_type get_allocator() const
+            {
+                return allocator_type(_keys.get_allocator());
+            }
+
+        private:
+            const key_type *_key_ptr() const
+            {
+                return _keys.begin().base();
+            }
+            iterator _iter(size_type i)
+            {
+                return iterator(_keys.begin().base() + i, _values.begin().base() + i);
+            }
+            const_iterator _iter(size_type i) const
+            {
+                return const_iterator(_keys.begin().base() + i, _values.begin().base() + i);
+            }
+                // first index whose key is not less than k
+            template <typename K>
+            size_type _lower_index(const K &k) const
+            {
+                const key_type *first = _key_ptr();
+                const key_type *base = first;
+                size_type n = size();
+
+                if (n == 0)
+                    return 0;
+                // the answer stays in [base, base + n], halving with a conditional move
+                // instead of a branch : the probe sequence only depends on n
+                while (n > 1)
+                {
+                    size_type half = n / 2;
+                    base = _comp(base[half], k) ? base + half : base;
+                    n -= half;
+                }
+                return (base - first) + _comp(*base, k);
+            }
+                // first index whose key is greater than k
+            template <typename K>
+            size_type _upper_index(const K &k) const
+            {
+                const key_type *first = _key_ptr();
+                const key_type *base = first;
+                size_type n = size();
+
+                if (n == 0)
+                    return 0;
+                while (n > 1)
+                {
+                    size_type half = n / 2;
+                    base = !_comp(k, base[half]) ? base + half : base;
+                    n -= half;
+                }
+                return (base - first) + !_comp(k, *base);
+            }
+                // index of k, size() if missing
+            template <typename K>
+            size_type _find_index(const K &k) const
+            {
+                size_type i = _lower_index(k);
+
+                if (i == size() || _comp(k, _keys[i]))
+                    return size();
+                return i;
+            }
+                // unique keys : the equal range is at most [i, i + 1)
+            template <typename K>
+            size_type _equal_end(size_type i, const K &k) const
+            {
+                return (i != size() && !_comp(k, _keys[i])) ? i + 1 : i;
+            }
+                // the key is taken back if the value cannot be inserted : both vectors keep the same length
+            void _insert_at(size_type i, const key_type &k, const mapped_type &v)
+            {
+                _keys.insert(_keys.begin() + i, k);
+                try
+                {
+                    _values.insert(_values.begin() + i, v);
+                }
+                catch (...)
+                {
+                    _keys.erase(_keys.begin() + i);
+                    throw;
+                }
+            }
+                // copy the range aside, stable sort it unless already sorted,
+                // then merge it with the current content in one pass :
+                // keys already present and later equivalent keys are dropped
+            template <class InputIt>
+            void _insert_range(InputIt first, InputIt last)
+            {
+                _entry_vector in;
+                bool sorted = true;
+
+                for (; first != last; ++first)
+                {
+                    in.push_back(_entry((*first).first, (*first).second));
+                    if (sorted && in.size() > 1 && _comp(in[in.size() - 1].first, in[in.size() - 2].first))
+                        sorted = false;
+                }
+                if (in.empty())
+                    return ;
+                if (!sorted)
+                {
+                    _entry_vector buf(in);
+                    ft::merge_sort(&in[0], &in[0] + in.size(), &buf[0], _entry_less(_comp));
+                }
+
+                key_container_type keys(_keys.get_allocator());
+                mapped_container_type values(_values.get_allocator());
+                keys.reserve(size() + in.size());
+                values.reserve(size() + in.size());
+
+                size_type i = 0;
+                size_type j = 0;
+                while (i < size() || j < in.size())
+                {
+                    if (j == in.size() || (i < size() && !_comp(in[j].first, _keys[i])))
+                    {
+                        // current element first, it also wins over an equivalent new one
+                        if (j < in.size() && !_comp(_keys[i], in[j].first))
+                            j = _skip_equal(in, j);
+                        keys.push_back(_keys[i]);
+                        values.push_back(_values[i]);
+                        ++i;
+                    }
+                    else
+                    {
+                        keys.push_back(in[j].first);
+                        values.push_back(in[j].second);
+                        j = _skip_equal(in, j);
+                    }
+                }
+                _keys.swap(keys);
+                _values.swap(values);
+            }
+                // index after the run of keys equivalent to in[j]
+            size_type _skip_equal(const _entry_vector &in, size_type j) const
+            {
+                size_type k = j + 1;
+
+                while (k < in.size() && !_comp(in[j].first, in[k].first))
+                    ++k;
+                return k;
+            }
+    };
+
+    // Non-member function overloads
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator==(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator!=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator<=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    inline bool operator>=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Alloc>
+    void swap(flat_map<Key, T, Compare, Alloc> &x, flat_map<Key, T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+}
+#endif
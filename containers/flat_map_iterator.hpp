@@ -0,0 +1,187 @@
+#ifndef FLAT_MAP_ITERATOR_HPP
+#define FLAT_MAP_ITERATOR_HPP
+
+#include "iterator_base.hpp"
+#include "pair.hpp"
+#include <cstddef> // std::ptrdiff_t
+
+namespace ft
+{
+    /**
+     * @brief flat_map reference
+     * What a flat_map iterator points to : the key and the mapped value, each in its own array.
+     * Reads like a value_type (first / second) and converts to one.
+     * (ft::pair<const Key &, T &> is not valid C++98 : pair declares const T1 & parameters)
+     */
+    template <typename Key, typename T, typename Mapped>
+    struct flat_map_reference
+    {
+        const Key   &first;
+        Mapped      &second;
+
+        flat_map_reference(const Key &key, Mapped &val)
+        : first(key), second(val)
+        {}
+
+        operator ft::pair<const Key, T>() const
+        {
+            return ft::pair<const Key, T>(first, second);
+        }
+    };
+
+    /**
+     * @brief flat_map iterator
+     * Walks the key array and the mapped array of a flat_map side by side.
+     * No value_type is stored anywhere : operator* returns a flat_map_reference
+     * and operator-> a small proxy holding one.
+     * @tparam Key key_type
+     * @tparam T mapped_type
+     * @tparam Mapped T (iterator) or const T (const_iterator)
+     */
+    template <typename Key, typename T, typename Mapped>
+    class flat_map_iterator
+    {
+        public:
+            typedef ft::random_access_iterator_tag  iterator_category;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef ft::pair<const Key, T>          value_type;
+            typedef flat_map_reference<Key, T, Mapped>  reference;
+            typedef flat_map_iterator<Key, T, Mapped> _Self;
+
+            class pointer
+            {
+                public:
+                    explicit pointer(const reference &ref)
+                    : _ref(ref)
+                    {}
+                    const reference *operator->() const
+                    {
+                        return &_ref;
+                    }
+                private:
+                    reference _ref;
+            };
+
+        // Member variables
+            const Key   *_key;
+            Mapped      *_val;
+
+        // Member functions
+            flat_map_iterator()
+            : _key(NULL), _val(NULL)
+            {}
+
+            flat_map_iterator(const Key *key, Mapped *val)
+            : _key(key), _val(val)
+            {}
+
+            template <typename M>   // iterator -> const_iterator
+            flat_map_iterator(const flat_map_iterator<Key, T, M> &x)
+            : _key(x._key), _val(x._val)
+            {}
+
+            reference operator*() const
+            {
+                return reference(*_key, *_val);
+            }
+            pointer operator->() const
+            {
+                return pointer(operator*());
+            }
+            reference operator[](difference_type n) const
+            {
+                return reference(_key[n], _val[n]);
+            }
+
+            _Self &operator++()
+            {
+                ++_key;
+                ++_val;
+                return *this;
+            }
+            _Self operator++(int)
+            {
+                _Self temp(*this);
+                ++(*this);
+                return temp;
+            }
+            _Self &operator--()
+            {
+                --_key;
+                --_val;
+                return *this;
+            }
+            _Self operator--(int)
+            {
+                _Self temp(*this);
+                --(*this);
+                return temp;
+            }
+            _Self &operator+=(difference_type n)
+            {
+                _key += n;
+                _val += n;
+                return *this;
+            }
+            _Self &operator-=(difference_type n)
+            {
+                _key -= n;
+                _val -= n;
+                return *this;
+            }
+            _Self operator+(difference_type n) const
+            {
+                return _Self(_key + n, _val + n);
+            }
+            _Self operator-(difference_type n) const
+            {
+                return _Self(_key - n, _val - n);
+            }
+
+            // iterator and const_iterator mix freely, the key pointer is enough
+            template <typename M>
+            difference_type operator-(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key - x._key;
+            }
+            template <typename M>
+            bool operator==(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key == x._key;
+            }
+            template <typename M>
+            bool operator!=(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key != x._key;
+            }
+            template <typename M>
+            bool operator<(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key < x._key;
+            }
+            template <typename M>
+            bool operator>(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key > x._key;
+            }
+            template <typename M>
+            bool operator<=(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key <= x._key;
+            }
+            template <typename M>
+            bool operator>=(const flat_map_iterator<Key, T, M> &x) const
+            {
+                return _key >= x._key;
+            }
+    };
+
+    template <typename Key, typename T, typename Mapped>
+    flat_map_iterator<Key, T, Mapped> operator+(typename flat_map_iterator<Key, T, Mapped>::difference_type n,
+                                                const flat_map_iterator<Key, T, Mapped> &it)
+    {
+        return it + n;
+    }
+}
+
+#endif
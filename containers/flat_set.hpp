@@ -0,0 +1,425 @@
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+
+#include <functional>
+#include <memory>
+#include <cstddef>
+#include "vector.hpp"
+#include "pair.hpp"
+#include "type_trait.hpp"
+#include "algorithm.hpp"
+#include "reverse_iterator.hpp"
+#include "flat_map.hpp"     // sorted_unique_t
+
+namespace ft
+{
+    /**
+     * @brief flat_set
+     * Same interface as ft::set, the keys live in one sorted ft::vector.
+     * Lookups are binary searches over contiguous keys, insert and erase shift the tail : O(n).
+     * Iterators are invalidated by every insertion and erasure.
+     */
+    template < class T,                  // flat_set::key_type/value_type
+    class Compare = std::less<T>,        // flat_set::key_compare/value_compare
+    class Alloc = std::allocator<T> >    // flat_set::allocator_type
+    class flat_set
+    {
+        public:
+            // Member types
+            typedef T                                     key_type;
+            typedef T                                     value_type;
+
+            typedef ptrdiff_t difference_type;
+            typedef size_t  size_type;
+
+            typedef Compare     key_compare;
+            typedef Compare     value_compare;
+            typedef Alloc       allocator_type;
+
+            typedef typename allocator_type::reference	        reference;
+            typedef typename allocator_type::const_reference	const_reference;
+            typedef typename allocator_type::pointer            pointer;
+            typedef typename allocator_type::const_pointer      const_pointer;
+
+            typedef ft::vector<value_type, allocator_type>      container_type;
+
+            // keys are never modified in place
+            typedef typename container_type::const_iterator     iterator;
+            typedef typename container_type::const_iterator     const_iterator;
+            typedef typename ft::reverse_iterator<iterator>         reverse_iterator;
+            typedef typename ft::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+        private:
+            container_type  _keys;
+            key_compare     _comp;
+
+        public:
+            // Constructor
+            explicit flat_set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _comp(comp)
+            {}
+                // range : sorted input is taken in one pass, anything else is stable sorted first
+            template <class InputIt>
+            flat_set(InputIt first, InputIt last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _comp(comp)
+            {
+                _insert_range(first, last);
+            }
+                // sorted_unique : [first, last) is trusted to be sorted without duplicates
+            template <class InputIt>
+            flat_set(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : _keys(first, last, alloc), _comp(comp)
+            {}
+                // Copy constructor
+            flat_set(const flat_set &x)
+            : _keys(x._keys), _comp(x._comp)
+            {}
+                // Destructor
+            ~flat_set()
+            {}
+            // Operator=
+            flat_set &operator=(const flat_set &x)
+            {
+                if (this != &x)
+                {
+                    _keys = x._keys;
+                    _comp = x._comp;
+                }
+                return *this;
+            }
+            // Member functions
+                // begin()
+            iterator begin() const
+            {
+                return _keys.begin();
+            }
+                // end()
+            iterator end() const
+            {
+                return _keys.end();
+            }
+                // rbegin()
+            reverse_iterator rbegin() const
+            {
+                return reverse_iterator(end());
+            }
+                // rend()
+            reverse_iterator rend() const
+            {
+                return reverse_iterator(begin());
+            }
+                // empty
+            bool empty() const
+            {
+                return _keys.empty();
+            }
+                // size
+            size_type size() const
+            {
+                return _keys.size();
+            }
+                // max_size
+            size_type max_size() const
+            {
+                return _keys.max_size();
+            }
+                // the sorted array
+            const container_type &keys() const
+            {
+                return _keys;
+            }
+
+            // Modifiers:
+                // insert
+                    //single element (1)
+            ft::pair<iterator, bool> insert(const value_type &val)
+            {
+                size_type i = _lower_index(val);
+
+                if (i != size() && !_comp(val, _keys[i]))
+                    return ft::make_pair(begin() + i, false);
+                _keys.insert(_keys.begin() + i, val);
+                return ft::make_pair(begin() + i, true);
+            }
+                    // with hint (2) : no search when val belongs right before position
+            iterator insert(iterator position, const value_type &val)
+            {
+                size_type i = position.base() - _key_ptr();
+
+                if ((i == size() || _comp(val, _keys[i])) && (i == 0 || _comp(_keys[i - 1], val)))
+                {
+                    _keys.insert(_keys.begin() + i, val);
+                    return begin() + i;
+                }
+                return insert(val).first;
+            }
+                    //range (3)
+            template <class InputIterator>
+            void insert(typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
+            {
+                _insert_range(first, last);
+            }
+                // erase
+                    // (1)
+            void erase(iterator position)
+            {
+                _keys.erase(_keys.begin() + (position.base() - _key_ptr()));
+            }
+                    // (2)
+            size_type erase(const key_type &k)
+            {
+                size_type i = _lower_index(k);
+
+                if (i == size() || _comp(k, _keys[i]))
+                    return 0;
+                _keys.erase(_keys.begin() + i);
+                return 1;
+            }
+                    // (3)
+            void erase(iterator first, iterator last)
+            {
+                _keys.erase(_keys.begin() + (first.base() - _key_ptr()), _keys.begin() + (last.base() - _key_ptr()));
+            }
+                // swap
+            void swap(flat_set &x)
+            {
+                _keys.swap(x._keys);
+                ft::swap(_comp, x._comp);
+            }
+                // clear
+            void clear()
+            {
+                _keys.clear();
+            }
+
+            // Observers
+                // key_comp
+            key_compare key_comp() const
+            {
+                return _comp;
+            }
+                //value_comp
+            value_compare value_comp() const
+            {
+                return _comp;
+            }
+
+            // Operation
+                    // lookups are templated on K for transparent comparators (see set)
+                // find
+            iterator find(const value_type &val) const
+            {
+                return begin() + _find_index(val);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            find(const K &k) const
+            {
+                return begin() + _find_index(k);
+            }
+                // count
+            size_type count(const value_type &val) const
+            {
+                return (_find_index(val) != size() ? 1 : 0);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            count(const K &k) const
+            {
+                return (_find_index(k) != size() ? 1 : 0);
+            }
+                // lower_bound
+            iterator lower_bound(const value_type &val) const
+            {
+                return begin() + _lower_index(val);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            lower_bound(const K &k) const
+            {
+                return begin() + _lower_index(k);
+            }
+                // upper_bound
+            iterator upper_bound(const value_type &val) const
+            {
+                return begin() + _upper_index(val);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            upper_bound(const K &k) const
+            {
+                return begin() + _upper_index(k);
+            }
+                // equal_range
+            ft::pair<iterator, iterator> equal_range(const value_type &val) const
+            {
+                size_type i = _lower_index(val);
+                return ft::pair<iterator, iterator>(begin() + i, begin() + _equal_end(i, val));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<iterator, iterator> >::type
+            equal_range(const K &k) const
+            {
+                size_type i = _lower_index(k);
+                return ft::pair<iterator, iterator>(begin() + i, begin() + _equal_end(i, k));
+            }
+
+            // Allocator
+            allocator_type get_allocator() const
+            {
+                return _keys.get_allocator();
+            }
+
+        private:
+            const value_type *_key_ptr() const
+            {
+                return _keys.begin().base();
+            }
+                // first index whose key is not less than k (same search as flat_map)
+            template <typename K>
+            size_type _lower_index(const K &k) const
+            {
+                const value_type *first = _key_ptr();
+                const value_type *base = first;
+                size_type n = size();
+
+                if (n == 0)
+                    return 0;
+                while (n > 1)
+                {
+                    size_type half = n / 2;
+                    base = _comp(base[half], k) ? base + half : base;
+                    n -= half;
+                }
+                return (base - first) + _comp(*base, k);
+            }
+                // first index whose key is greater than k
+            template <typename K>
+            size_type _upper_index(const K &k) const
+            {
+                const value_type *first = _key_ptr();
+                const value_type *base = first;
+                size_type n = size();
+
+                if (n == 0)
+                    return 0;
+                while (n > 1)
+                {
+                    size_type half = n / 2;
+                    base = !_comp(k, base[half]) ? base + half : base;
+                    n -= half;
+                }
+                return (base - first) + !_comp(k, *base);
+            }
+                // index of k, size() if missing
+            template <typename K>
+            size_type _find_index(const K &k) const
+            {
+                size_type i = _lower_index(k);
+
+                if (i == size() || _comp(k, _keys[i]))
+                    return size();
+                return i;
+            }
+            template <typename K>
+            size_type _equal_end(size_type i, const K &k) const
+            {
+                return (i != size() && !_comp(k, _keys[i])) ? i + 1 : i;
+            }
+                // same scheme as flat_map : copy, sort if needed, merge, first equivalent key wins
+            template <class InputIt>
+            void _insert_range(InputIt first, InputIt last)
+            {
+                container_type in(_keys.get_allocator());
+                bool sorted = true;
+
+                for (; first != last; ++first)
+                {
+                    in.push_back(*first);
+                    if (sorted && in.size() > 1 && _comp(in[in.size() - 1], in[in.size() - 2]))
+                        sorted = false;
+                }
+                if (in.empty())
+                    return ;
+                if (!sorted)
+                {
+                    container_type buf(in);
+                    ft::merge_sort(&in[0], &in[0] + in.size(), &buf[0], _comp);
+                }
+
+                container_type keys(_keys.get_allocator());
+                keys.reserve(size() + in.size());
+
+                size_type i = 0;
+                size_type j = 0;
+                while (i < size() || j < in.size())
+                {
+                    if (j == in.size() || (i < size() && !_comp(in[j], _keys[i])))
+                    {
+                        if (j < in.size() && !_comp(_keys[i], in[j]))
+                            j = _skip_equal(in, j);
+                        keys.push_back(_keys[i]);
+                        ++i;
+                    }
+                    else
+                    {
+                        keys.push_back(in[j]);
+                        j = _skip_equal(in, j);
+                    }
+                }
+                _keys.swap(keys);
+            }
+            size_type _skip_equal(const container_type &in, size_type j) const
+            {
+                size_type k = j + 1;
+
+                while (k < in.size() && !_comp(in[j], in[k]))
+                    ++k;
+                return k;
+            }
+    };
+
+    // Non-member function overloads
+    template <class T, class Compare, class Alloc>
+    inline bool operator==(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return lhs.keys() == rhs.keys();
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator!=(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator<(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return lhs.keys() < rhs.keys();
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator>(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator<=(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    inline bool operator>=(const flat_set<T, Compare, Alloc> &lhs, const flat_set<T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Compare, class Alloc>
+    void swap(flat_set<T, Compare, Alloc> &x, flat_set<T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+}
+#endif
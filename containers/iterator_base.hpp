@@ -2,6 +2,7 @@
 # define ITERATOR_HPP
 
 # include <cstddef>
+# include <iterator> // std::input_iterator_tag
 
 namespace ft
 {
@@ -12,6 +13,23 @@ namespace ft
     struct bidirectional_iterator_tag   : public forword_iterator_tag {};
     struct random_access_iterator_tag   : public bidirectional_iterator_tag {};
 
+    // true for the single-pass categories (std's or ours) : such a range can be read only once
+    template <typename Category>
+    struct is_single_pass
+    {
+        static const bool value = false;
+    };
+    template <>
+    struct is_single_pass<input_iterator_tag>
+    {
+        static const bool value = true;
+    };
+    template <>
+    struct is_single_pass<std::input_iterator_tag>
+    {
+        static const bool value = true;
+    };
+
 /**
  * @param Category  : Category to which the iterator belongs to
  * @param T		    : Type of elements pointed by the iterator
@@ -29,7 +29,8 @@ namespace ft
     template <typename Key,										   // map::key_type
 			  typename T,											   // map::mapped_type
 			  typename Compare = std::less<Key>,					   // map::key_compare
-			  typename Alloc = std::allocator<ft::pair<const Key, T> > // map::allocator_type
+			  typename Alloc = std::allocator<ft::pair<const Key, T> >, // map::allocator_type
+			  typename Augment = ft::plain_nodes						   // ft::order_statistics : find_by_order, ...
 			  >
     class map
     {
@@ -51,7 +52,7 @@ namespace ft
             typedef typename allocator_type::const_pointer           const_pointer;
 
         protected:
-            typedef rbtree<key_type, value_type, _Slect1st<value_type>, key_compare, allocator_type> tree_type;
+            typedef rbtree<key_type, value_type, _Slect1st<value_type>, key_compare, allocator_type, Augment> tree_type;
             typedef typename tree_type::node_type node_type;
             typedef typename tree_type::node_ptr node_ptr;
         public:
@@ -88,10 +89,8 @@ namespace ft
         public:
             // Constructor
             explicit map( const key_compare &comp = key_compare(),const allocator_type &alloc = allocator_type())
-            {
-                (void)comp;
-                (void)alloc;
-            }
+            : _tree(comp, alloc)
+            {}
 
 				/**
 				 * @brief Range constructor
@@ -106,34 +105,22 @@ namespace ft
 				 */
             template<class InputIt>
             map( InputIt first, InputIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+            : _tree(comp, alloc)
 			{   
-                (void)comp;
-			    (void)alloc;
-			    for (InputIt it = first; it != last; ++it)
-			    {
-				    this->insert(*it);
-		    	}
+                _tree._insert_range_unique(first, last);
 			}
 				// Copy constructor
 			map(const map& x)
-            {
-                *this = x;
-            }
+            : _tree(x._tree)
+            {}
 				// Destructor
-			virtual ~map() 
-			{
-				while(!this->empty())
-					this->erase(this->begin());
-			}
+			~map() 
+			{}
 			// Operator=
 			map& operator=(const map& __x)
 			{
 				if (this != &__x)
-				{
-                    this->clear();
-                    for (const_iterator it = __x.begin(); it != __x.end(); ++it)
-                        this->insert(*it);
-                }
+                    _tree = __x._tree;
 				return *this;
 			}
 			// Member functions
@@ -198,9 +185,14 @@ namespace ft
                 // operation[]
             mapped_type& operator[] (const key_type& k)
             {
-                ((this->insert(ft::make_pair(k, mapped_type()))));
-                return this->find(k)->second;
-                // return (*((this->insert(ft::make_pair(k, mapped_type()))).first)).second;
+                node_ptr parent;
+                bool left;
+                node_ptr temp = _tree._find_unique_pos(k, parent, left);
+
+                // mapped_type is only default-constructed when k is missing
+                if (!temp)
+                    temp = _tree._insert_at(parent, left, value_type(k, mapped_type()));
+                return temp->_data.second;
             }
 
             // Modifiers:
@@ -208,27 +200,19 @@ namespace ft
                     //single element (1)	
             ft::pair<iterator,bool> insert(const value_type& val)
             {
-                node_ptr temp = _tree._find_key(val.first);
-                if (temp)
-                    return ft::make_pair(iterator(temp), false);
-                else
-                {
-                    temp = _tree._rb_insert(val);
-                    return ft::make_pair(iterator(temp), true);
-                }
+                ft::pair<node_ptr, bool> ret = _tree._insert_unique(val);
+                return ft::make_pair(iterator(ret.first), ret.second);
             }
                     // with hint (2)	
             iterator insert (iterator position, const value_type& val)
             {
-                (void)position;
-			    return this->insert(val).first;
+                return iterator(_tree._insert_hint_unique(position.base(), val));
             }
                     //range (3)	
             template <class InputIterator>
             void insert (typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
             {
-                for (; first != last; first++)
-				    this->insert(*first);
+                _tree._insert_range_unique(first, last);
             }
                 // erase
                     // (1)	
@@ -251,13 +235,7 @@ namespace ft
                     // (3)	
             void erase (iterator first, iterator last)
             {
-                iterator it = first++;
-
-                while(it != last)
-                {
-                    this->_tree._rb_delete(it._node);
-                    it = first++;
-                }
+                _tree._erase_range(first.base(), last.base());
             }
                 // swap
             void swap(map &x)
@@ -268,20 +246,32 @@ namespace ft
                 // clear
             void clear()
             {
-                while(!this->empty())
-                    this->erase(this->begin());
+                _tree.clear();
+            }
+                // split : keys not less than k are moved into x (its content is dropped),
+                //  O(log n), the nodes themselves move : no copy, no allocation
+            void split(const key_type &k, map &x)
+            {
+                _tree._split_off(k, x._tree);
+            }
+                // merge : moves the elements of x whose key is not in this map, x keeps the others.
+                //  O(log n) when every key of x is greater (or less) than all of ours,
+                //  one insert per element otherwise, nodes are relinked either way
+            void merge(map &x)
+            {
+                _tree._merge_unique(x._tree);
             }
             
             // Observers
                 // key_comp
             key_compare key_comp() const
             {
-                return key_compare();
+                return _tree.key_comp();
             }
                 //value_comp
             value_compare value_comp() const
             {
-                return value_compare(key_compare());
+                return value_compare(_tree.key_comp());
             }
             
             // Operation
@@ -302,57 +292,124 @@ namespace ft
                 else
                     return this->end();
             }
-                // size
+                    // heterogeneous lookup : only when key_compare is transparent,
+                    // k is compared as is, no key_type is constructed
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            find (const K& k)
+            {
+                node_ptr temp = _tree._find_key(k);
+                return temp ? iterator(temp) : this->end();
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            find (const K& k) const
+            {
+                node_ptr temp = _tree._find_key(k);
+                return temp ? const_iterator(temp) : this->end();
+            }
+                // count
             size_type count (const key_type& k) const
             {
-                size_type n = 0;
-                for (const_iterator it = this->begin(); it != this->end(); ++it)
-                {
-                    if (_tree._equal(k,it->first))
-                        ++n;
-                }
-                return n;
+                // unique keys : count is either 0 or 1
+                return (_tree._find_key(k) ? 1 : 0);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            count (const K& k) const
+            {
+                return (_tree._find_key(k) ? 1 : 0);
             }
                     // std::less::operator() lhs < rhs 이면 true , 그렇지 않으면 false 입니다.
                 //lower_bound
             iterator lower_bound (const key_type& k)
             {
-                iterator it = this->begin();
-                while(key_comp()(it->first, k) && it != this->end())
-                    ++it;
-                return it;
+                return iterator(_tree._lower_bound(k));
             }
             const_iterator lower_bound (const key_type& k) const
             {
-                const_iterator it = this->begin();
-                while(key_comp()(it->first, k) && it != this->end())
-                    ++it;
-                return it;
+                return const_iterator(_tree._lower_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            lower_bound (const K& k)
+            {
+                return iterator(_tree._lower_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            lower_bound (const K& k) const
+            {
+                return const_iterator(_tree._lower_bound(k));
             }
                 // upper_bound
             iterator upper_bound (const key_type& k)
             {
-               iterator it = this->begin();
-                while(!key_comp()(k, it->first) && it != this->end())
-                    ++it;
-                return it;
+                return iterator(_tree._upper_bound(k));
             }
             const_iterator upper_bound (const key_type& k) const
             {
-                const_iterator it = this->begin();
-                while(!key_comp()(k, it->first) && it != this->end())
-                    ++it;
-                return it;
+                return const_iterator(_tree._upper_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            upper_bound (const K& k)
+            {
+                return iterator(_tree._upper_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+            upper_bound (const K& k) const
+            {
+                return const_iterator(_tree._upper_bound(k));
             }
                 // equal_range
             ft::pair<iterator,iterator>equal_range (const key_type& k)
             {
-                return ft::pair<iterator,iterator>(lower_bound(k),upper_bound(k));
-                // return ft::make_pair(lower_bound(k),upper_bound(k));
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<iterator,iterator>(iterator(range.first), iterator(range.second));
             }
             ft::pair<const_iterator,const_iterator>equal_range (const key_type& k) const
             {
-                return ft::make_pair(lower_bound(k),upper_bound(k));
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<const_iterator,const_iterator>(const_iterator(range.first), const_iterator(range.second));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<iterator,iterator> >::type
+            equal_range (const K& k)
+            {
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<iterator,iterator>(iterator(range.first), iterator(range.second));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<const_iterator,const_iterator> >::type
+            equal_range (const K& k) const
+            {
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<const_iterator,const_iterator>(const_iterator(range.first), const_iterator(range.second));
+            }
+
+            // Order statistics : O(log n) through the subtree sizes of the nodes,
+            // only with Augment = ft::order_statistics (plain nodes don't keep them)
+                // find_by_order : k-th element in key order (0-based), end() if k >= size()
+            iterator find_by_order(size_type k)
+            {
+                return iterator(_tree._find_by_order(k));
+            }
+            const_iterator find_by_order(size_type k) const
+            {
+                return const_iterator(_tree._find_by_order(k));
+            }
+                // order_of_key : number of keys less than k
+            size_type order_of_key(const key_type &k) const
+            {
+                return _tree._order_of_key(k);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            order_of_key(const K &k) const
+            {
+                return _tree._order_of_key(k);
             }
 
             // Allocator
@@ -364,44 +421,44 @@ namespace ft
     };
     // Non-member functions
         // Relational operators
-    template <typename Key, typename T, typename Compare, typename Alloc>
-    inline bool operator==(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator==(const map<Key, T, Compare, Alloc, Augment> &lhs, const map<Key, T, Compare, Alloc, Augment> &rhs)
     { 
         return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); 
     }
 
-    template <typename Key, typename T, typename Compare, typename Alloc>
-    inline bool operator!=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator!=(const map<Key, T, Compare, Alloc, Augment> &lhs, const map<Key, T, Compare, Alloc, Augment> &rhs)
     { 
         return !(lhs == rhs); 
     }
 
-    template <typename Key, typename T, typename Compare, typename Alloc>
-    inline bool operator<(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator<(const map<Key, T, Compare, Alloc, Augment> &lhs, const map<Key, T, Compare, Alloc, Augment> &rhs)
     { 
         return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); 
     }
 
-    template <typename Key, typename T, typename Compare, typename Alloc>
-    inline bool operator>(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator>(const map<Key, T, Compare, Alloc, Augment> &lhs, const map<Key, T, Compare, Alloc, Augment> &rhs)
     { 
         return rhs < lhs; 
     }
 
-    template <typename Key, typename T, typename Compare, typename Alloc>
-    inline bool operator<=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator<=(const map<Key, T, Compare, Alloc, Augment> &lhs, const map<Key, T, Compare, Alloc, Augment> &rhs)
     { 
         return !(rhs < lhs); 
     }
 
-    template <typename _Key, typename _T, typename Compare, typename Alloc>
-    inline bool operator>=(const map<_Key, _T, Compare, Alloc> &lhs, const map<_Key, _T, Compare, Alloc> &rhs)
+    template <typename _Key, typename _T, typename Compare, typename Alloc, typename Augment>
+    inline bool operator>=(const map<_Key, _T, Compare, Alloc, Augment> &lhs, const map<_Key, _T, Compare, Alloc, Augment> &rhs)
     { 
         return !(lhs < rhs); 
     }
 
-    template <typename _Key, typename _T, typename Compare, typename Alloc>
-    void swap(map<_Key, _T, Compare, Alloc>& x, map<_Key, _T, Compare, Alloc>& y)
+    template <typename _Key, typename _T, typename Compare, typename Alloc, typename Augment>
+    void swap(map<_Key, _T, Compare, Alloc, Augment>& x, map<_Key, _T, Compare, Alloc, Augment>& y)
     { 
         x.swap(y); 
     }
@@ -0,0 +1,184 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <new>       // operator new, placement new
+
+namespace ft
+{
+    /**
+     * @brief Node pool
+     * Hands out fixed-size blocks carved from large chunks,
+     * freed blocks are kept in a free list and reused first.
+     * Chunks are only given back to the system when the pool dies.
+     * @tparam Size size of one block
+     */
+    template <std::size_t Size>
+    class node_pool
+    {
+        private:
+            union block
+            {
+                block       *_next;
+                char        _data[Size];
+                // alignment of any scalar type
+                long double _align_ld;
+                void        *_align_ptr;
+            };
+
+            block       *_chunks;     // chunk list, first block of each chunk is the link
+            block       *_free;       // free list
+            block       *_cur;        // next never used block of the current chunk
+            block       *_cur_end;
+            std::size_t _chunk_size;  // blocks per chunk, doubles up to _max_chunk_size
+
+            static const std::size_t _min_chunk_size = 64;
+            static const std::size_t _max_chunk_size = 8192;
+
+            node_pool(const node_pool &);
+            node_pool &operator=(const node_pool &);
+
+            void _grow()
+            {
+                block *chunk = static_cast<block *>(::operator new(_chunk_size * sizeof(block)));
+
+                chunk->_next = _chunks;
+                _chunks = chunk;
+                _cur = chunk + 1;
+                _cur_end = chunk + _chunk_size;
+                if (_chunk_size < _max_chunk_size)
+                    _chunk_size *= 2;
+            }
+
+        public:
+            node_pool()
+            : _chunks(NULL), _free(NULL), _cur(NULL), _cur_end(NULL), _chunk_size(_min_chunk_size)
+            {}
+            ~node_pool()
+            {
+                while (_chunks)
+                {
+                    block *next = _chunks->_next;
+                    ::operator delete(_chunks);
+                    _chunks = next;
+                }
+            }
+
+            void *get()
+            {
+                if (_free)
+                {
+                    block *b = _free;
+                    _free = b->_next;
+                    return b;
+                }
+                if (_cur == _cur_end)
+                    _grow();
+                return _cur++;
+            }
+            void put(void *p)
+            {
+                block *b = static_cast<block *>(p);
+                b->_next = _free;
+                _free = b;
+            }
+
+            // one pool per block size, shared by every pool_allocator of that size
+            static node_pool &instance()
+            {
+                static node_pool pool;
+                return pool;
+            }
+    };
+
+    /**
+     * @brief Pool allocator
+     * Standard allocator whose single-object allocations (the nodes of ft::map / ft::set)
+     * come from a node_pool, array allocations go to operator new.
+     * All instances share the pool of their size, so they always compare equal.
+     * Not thread-safe.
+     * @tparam T value_type
+     */
+    template <typename T>
+    class pool_allocator
+    {
+        public:
+            // Member types
+            typedef T                   value_type;
+            typedef T*                  pointer;
+            typedef const T*            const_pointer;
+            typedef T&                  reference;
+            typedef const T&            const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template <typename U>
+            struct rebind
+            {
+                typedef pool_allocator<U> other;
+            };
+
+        private:
+            typedef node_pool<sizeof(T)>  pool_type;
+
+        public:
+            // Constructor
+            pool_allocator() {}
+            pool_allocator(const pool_allocator &) {}
+            template <typename U>
+            pool_allocator(const pool_allocator<U> &) {}
+            ~pool_allocator() {}
+
+            pointer address(reference x) const
+            {
+                return &x;
+            }
+            const_pointer address(const_reference x) const
+            {
+                return &x;
+            }
+
+            pointer allocate(size_type n, const void *hint = 0)
+            {
+                (void)hint;
+                if (n == 1)
+                    return static_cast<pointer>(pool_type::instance().get());
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+            }
+            void deallocate(pointer p, size_type n)
+            {
+                if (n == 1)
+                    pool_type::instance().put(p);
+                else
+                    ::operator delete(p);
+            }
+
+            size_type max_size() const
+            {
+                return size_type(-1) / sizeof(T);
+            }
+
+            void construct(pointer p, const_reference val)
+            {
+                new(static_cast<void *>(p)) T(val);
+            }
+            void destroy(pointer p)
+            {
+                p->~T();
+            }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const pool_allocator<T> &, const pool_allocator<U> &)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &)
+    {
+        return false;
+    }
+}
+
+#endif
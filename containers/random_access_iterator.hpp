@@ -39,9 +39,6 @@ class random_access_iterator: public ft::iterator<typename ft::iterator_traits<I
         random_access_iterator(const random_access_iterator<Iter>& it)
         :current_state(it.base()) {}
         
-    // 소멸자
-        virtual ~random_access_iterator() {}
-        
         // return base iterator
         iterator_type base() const
         {
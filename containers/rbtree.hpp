@@ -1,6 +1,7 @@
 #ifndef RBTREE_HPP
 #define RBTREE_HPP
 
+#include <cstddef> // std::size_t
 #include <functional> // std::less
 #include <iostream>
 #include "type_trait.hpp"
@@ -21,70 +22,174 @@ namespace ft
         BLACK
     };    
 
-    template <typename T> 
-    struct rbtree_node
+    // what a node keeps besides value / links, chosen by the tree's Augment parameter
+        // plain_nodes : nothing (empty base), the count updates compile away
+        // and select / rank / advance don't compile
+    template <typename Augment>
+    struct rbtree_node_count
+    {
+        static const bool counted = false;
+
+        void set_size(std::size_t) {}
+        void copy_size(const rbtree_node_count &) {}
+        void count(bool) {}
+    };
+
+        // order_statistics : number of nodes in the subtree rooted here, unused in the header
+    template <>
+    struct rbtree_node_count<order_statistics>
+    {
+        static const bool counted = true;
+
+        std::size_t _size;
+
+        rbtree_node_count() : _size(1) {}
+
+        std::size_t size() const { return _size; }
+        void set_size(std::size_t n) { _size = n; }
+        void copy_size(const rbtree_node_count &x) { _size = x._size; }
+        void count(bool grow) { grow ? ++_size : --_size; }
+    };
+
+    template <typename T, typename Augment>
+    struct rbtree_node : public rbtree_node_count<Augment>
     {
         
         public :
             // Member types
             typedef T   value_type;
-            typedef rbtree_node<value_type> node_type;
-            typedef std::allocator<node_type> node_allocator_type;
+            typedef rbtree_node<value_type, Augment> node_type;
             typedef node_type *node_ptr;
             typedef const node_type *const_node_ptr;
 
-            value_type _data;
-            // color_type  _color;
-            int         _color;
-            node_ptr    _parent;
+            value_type  _data;
+            // parent pointer, color in the low bit (nodes are at least pointer aligned)
+            std::size_t _parent_color;
             node_ptr    _left;
             node_ptr    _right;
 
-            rbtree_node(node_ptr parent, node_ptr left, node_ptr right, value_type data, int color)
-            : _data(data),_color(color), _parent(parent), _left(left), _right(right)
+            rbtree_node(node_ptr parent, node_ptr left, node_ptr right, const value_type &data, int color)
+            : _data(data), _parent_color(reinterpret_cast<std::size_t>(parent) | color), _left(left), _right(right)
             {}
           
             ~rbtree_node() {}
 
-            static bool isTNULL(node_ptr x)
+            node_ptr parent() const
             {
-                if (x && x->_left == NULL)
-                    return true;
-                else
-                    return false;
+                return reinterpret_cast<node_ptr>(_parent_color & ~static_cast<std::size_t>(1));
             }
-            static bool isTNULL(const_node_ptr x)
+            int color() const
             {
-                if (x && x->_left == NULL)
-                    return true;
-                else
-                    return false;
+                return static_cast<int>(_parent_color & 1);
+            }
+            void set_parent(node_ptr p)
+            {
+                _parent_color = reinterpret_cast<std::size_t>(p) | (_parent_color & 1);
+            }
+            void set_color(int color)
+            {
+                _parent_color = (_parent_color & ~static_cast<std::size_t>(1)) | color;
+            }
+            void set_parent_color(node_ptr p, int color)
+            {
+                _parent_color = reinterpret_cast<std::size_t>(p) | color;
+            }
+
+            // the header (end()) is the only node whose _left points to itself
+            bool is_header() const
+            {
+                return _left == this;
             }
             static node_ptr tree_minimum(node_ptr x)
             {
-                while (x && !isTNULL(x->_left))
+                while (x && x->_left)
                     x = x->_left;
                 return x;
             }
             static const_node_ptr tree_minimum(const_node_ptr x)
             {
-                while (x && !isTNULL(x->_left))
+                while (x && x->_left)
                     x = x->_left;
                 return x;
             }
             static node_ptr tree_maximum(node_ptr x)
             {
-                while (x && !isTNULL(x->_right))
+                while (x && x->_right)
                     x = x->_right;
                 return x;
             }
             static const_node_ptr tree_maximum(const_node_ptr x)
             {
-                while (x && !isTNULL(x->_right))
+                while (x && x->_right)
                     x = x->_right;
                 return x;
             }
 
+            // order statistics (order_statistics nodes only, update_size is a no-op otherwise)
+            static std::size_t subtree_size(const_node_ptr x)
+            {
+                return x ? x->size() : 0;
+            }
+            void update_size()
+            {
+                _update_size(ft::integral_constant<bool, node_type::counted>());
+            }
+                // k-th node (0-based) of the subtree rooted at x, k < subtree_size(x)
+            static node_ptr select(node_ptr x, std::size_t k)
+            {
+                while (true)
+                {
+                    std::size_t l = subtree_size(x->_left);
+                    if (k == l)
+                        return x;
+                    if (k < l)
+                        x = x->_left;
+                    else
+                    {
+                        k -= l + 1;
+                        x = x->_right;
+                    }
+                }
+            }
+                // in-order index of x in its tree, the header's is the size of the tree
+            static std::size_t rank(const_node_ptr x)
+            {
+                const_node_ptr header;
+                return rank(x, header);
+            }
+                // node n steps away from x (the header is one past the last node)
+            static node_ptr advance(const_node_ptr x, std::ptrdiff_t n)
+            {
+                const_node_ptr header;
+                std::size_t r = rank(x, header) + n;
+
+                if (r == subtree_size(header->parent()))
+                    return header->_left;   // the header itself, as a node_ptr
+                return select(header->parent(), r);
+            }
+        private:
+            void _update_size(ft::true_type)
+            {
+                this->set_size(subtree_size(_left) + subtree_size(_right) + 1);
+            }
+            void _update_size(ft::false_type) {}
+
+                // one climb up to the header, which is handed back
+            static std::size_t rank(const_node_ptr x, const_node_ptr &header)
+            {
+                if (x->is_header())
+                {
+                    header = x;
+                    return subtree_size(x->parent());
+                }
+                std::size_t r = subtree_size(x->_left);
+                const_node_ptr y = x->parent();
+                for (; !y->is_header(); x = y, y = y->parent())
+                    if (x == y->_right)
+                        r += subtree_size(y->_left) + 1;
+                header = y;
+                return r;
+            }
     };
 
     // rbtree;
@@ -93,7 +198,8 @@ namespace ft
             typename Val,
             typename KeyOfValue,
             typename Compare = std::less<Key>,
-            typename Alloc = std::allocator<Val>
+            typename Alloc = std::allocator<Val>,
+            typename Augment = plain_nodes
             >
     class rbtree
     {
@@ -105,14 +211,14 @@ namespace ft
             typedef Alloc                                                  allocator_type;
             typedef Compare                                                key_compare;
             typedef std::size_t                                            size_type;
-            typedef ft::rbtree_node<value_type>                            node_type;
-            // typedef typename allocator_type::template rebind<node_type>::other _no;
-            typedef typename node_type::node_allocator_type                node_allocator_type;
-            typedef typename ft::rbtree_node<value_type>::node_ptr         node_ptr;
-            typedef typename ft::rbtree_node<value_type>::const_node_ptr   const_node_ptr;
-
-            typedef ft::rbtree_iterator<value_type>					iterator;
-		    typedef ft::rbtree_const_iterator<value_type>		    const_iterator;
+            typedef ft::rbtree_node<value_type, Augment>                   node_type;
+            // nodes come from the container's allocator, rebound to node_type
+            typedef typename allocator_type::template rebind<node_type>::other node_allocator_type;
+            typedef typename node_type::node_ptr                           node_ptr;
+            typedef typename node_type::const_node_ptr                     const_node_ptr;
+
+            typedef ft::rbtree_iterator<value_type, Augment>			iterator;
+		    typedef ft::rbtree_const_iterator<value_type, Augment>    const_iterator;
             typedef ft::reverse_iterator<iterator>					reverse_iterator;
 		    typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
         // Member variables
@@ -121,7 +227,8 @@ namespace ft
             // allocator_type          _alloc;
             // _no                     _n;
             node_ptr                _root;
-            node_ptr                _TNULL;
+            node_ptr                _header;    // end(), parent() : root, _left : itself, _right : rightmost node
+            node_ptr                _leftmost;  // begin()
             key_compare             _comp;
             size_type               _node_cnt;
 
@@ -130,49 +237,100 @@ namespace ft
                 // std::less() 에서 () 연산자 가 val.first,(first로만) 로 값을 비교해준다.
         public:
             // Constructor
-            rbtree()
-            :_node_cnt(0)
+            explicit rbtree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            :_node_alloc(alloc), _comp(comp), _node_cnt(0)
             {
-                _TNULL = _getnode(node_type(NULL, NULL, NULL, value_type(), BLACK));
+                _header = _get_header();
                 // _root = _getnode(node_type(NULL, _TNULL, _TNULL, value_type(), RED));
-                _root = _TNULL;
+                _root = NULL;
+                _leftmost = _header;
+            }
+            // Copy constructor : structural clone, O(n) without any comparison
+            rbtree(const rbtree &x)
+            :_node_alloc(x._node_alloc), _comp(x._comp), _node_cnt(0)
+            {
+                _header = _get_header();
+                _root = NULL;
+                _leftmost = _header;
+                try
+                {
+                    _copy_from(x);
+                }
+                catch (...)
+                {
+                    // no destructor runs for a throwing constructor
+                    _node_alloc.deallocate(_header, 1);
+                    throw;
+                }
+            }
+            rbtree &operator=(const rbtree &x)
+            {
+                if (this != &x)
+                {
+                    this->clear();
+                    _comp = x._comp;
+                    _copy_from(x);
+                }
+                return *this;
+            }
+            ~rbtree()
+            {
+                _destroy_subtree(_root);
+                _node_alloc.deallocate(_header, 1);
             }
-            bool _equal(const key_type &a, const key_type &b) const
-			{
-				return (!_comp(a,b) && !_comp(b,a));
-			}
             // Iterator
                 // begin
             iterator begin()
             {
-                if (this->_node_cnt == 0) // size == 0 일때 는 end() 반환 
-                    return this->end();
-                node_ptr temp = ft::rbtree_node<value_type>::tree_minimum(this->get_root());
-                return (iterator(temp));
+                // size == 0 일때 는 _leftmost == _header, end() 반환
+                return (iterator(_leftmost));
             }
             const_iterator begin() const
             {
-                if (this->_node_cnt == 0) // size == 0 일때 는 end() 반환 
-                    return this->end();
-                node_ptr temp = ft::rbtree_node<value_type>::tree_minimum(this->get_root());
-                return (const_iterator(temp));
+                return (const_iterator(_leftmost));
             }
             //     // end
             iterator end() 
             {
                 // node_ptr temp =ft::rbtree_node<value_type>::tree_minum()
-                return iterator(this->getTNULL());
-                // return iterator(this->_TNULL);
+                return iterator(this->get_header());
             }
             const_iterator end() const
             {
-                return const_iterator(this->getTNULL());
-                // return const_iterator(this->_TNULL);
+                return const_iterator(this->get_header());
+            }
+                // the value is constructed directly inside the node, copied once from data
+            node_ptr _getnode(const value_type &data, node_ptr parent, node_ptr left, node_ptr right, int color)
+            {
+                node_ptr ptr = _node_alloc.allocate(1);
+                try
+                {
+                    allocator_type(_node_alloc).construct(&ptr->_data, data);
+                }
+                catch (...)
+                {
+                    _node_alloc.deallocate(ptr, 1);
+                    throw;
+                }
+                ptr->set_parent_color(parent, color);
+                ptr->_left = left;
+                ptr->_right = right;
+                ptr->set_size(1);
+                return ptr;
+            }
+            void _putnode(node_ptr ptr)
+            {
+                allocator_type(_node_alloc).destroy(&ptr->_data);
+                _node_alloc.deallocate(ptr, 1);
             }
-            node_ptr _getnode(node_type temp)
+                // the header only needs its links, its value is never constructed
+            node_ptr _get_header()
             {
                 node_ptr ptr = _node_alloc.allocate(1);
-                _node_alloc.construct(ptr, temp);
+                ptr->set_parent_color(NULL, BLACK);
+                ptr->_left = ptr;
+                ptr->_right = ptr; // rightmost of an empty tree
+                ptr->set_size(0);
                 return ptr;
             }
                 // rbegin()
@@ -195,132 +353,433 @@ namespace ft
             }
 
             
-            node_ptr _find_key(key_type key) const
+                // lookups take any K the comparator accepts next to key_type (see is_transparent),
+                // always by reference : no key is built nor copied
+            template <typename K>
+            node_ptr _find_key(const K &key) const
             {
                 node_ptr temp = _root;
-                if (_root->_color == RED)
-                    return NULL;
-                
-                while (temp != _TNULL && !_equal(key, KeyOfValue()(temp->_data)))
+
+                while (temp != NULL)
                 {
-                    
                     if (_comp(key, KeyOfValue()(temp->_data)))
 						temp = temp->_left;
-					else
+					else if (_comp(KeyOfValue()(temp->_data), key))
 						temp = temp->_right;
+                    else
+                        break;
                 }
-                if (temp == _TNULL)
-                    return NULL;
 				return temp;
             }
+                // bounds
+                    // first node whose key is not less than key (header if none)
+            template <typename K>
+            node_ptr _lower_bound(const K &key) const
+            {
+                return _lower_bound(_root, _header, key);
+            }
+                    // first node whose key is greater than key (header if none)
+            template <typename K>
+            node_ptr _upper_bound(const K &key) const
+            {
+                return _upper_bound(_root, _header, key);
+            }
+                    // [lower_bound, upper_bound) in a single descent
+            template <typename K>
+            ft::pair<node_ptr, node_ptr> _equal_range(const K &key) const
+            {
+                node_ptr x = _root;
+                node_ptr y = _header;
+
+                while (x != NULL)
+                {
+                    if (_comp(KeyOfValue()(x->_data), key))
+                        x = x->_right;
+                    else if (_comp(key, KeyOfValue()(x->_data)))
+                    {
+                        y = x;
+                        x = x->_left;
+                    }
+                    else
+                    {
+                        // equal key found : the two bounds split here,
+                        // lower bound is in the left subtree, upper bound in the right one
+                        node_ptr xu = x->_right;
+                        node_ptr yu = y;
+                        return ft::pair<node_ptr, node_ptr>(_lower_bound(x->_left, x, key),
+                                                            _upper_bound(xu, yu, key));
+                    }
+                }
+                return ft::pair<node_ptr, node_ptr>(y, y);
+            }
+                // count
+                    // number of nodes equivalent to key, bounded by _equal_range
+                    // (unique-key containers should prefer _find_key)
+            template <typename K>
+            size_type _count(const K &key) const
+            {
+                ft::pair<node_ptr, node_ptr> range = _equal_range(key);
+                size_type n = 0;
+
+                for (const_iterator it(range.first); it != const_iterator(range.second); ++it)
+                    ++n;
+                return n;
+            }
+                // order statistics
+                    // k-th node in key order (0-based), header if k >= size()
+            node_ptr _find_by_order(size_type k) const
+            {
+                if (k >= _node_cnt)
+                    return _header;
+                return node_type::select(_root, k);
+            }
+                    // number of keys less than key, in one descent
+            template <typename K>
+            size_type _order_of_key(const K &key) const
+            {
+                node_ptr x = _root;
+                size_type r = 0;
+
+                while (x != NULL)
+                {
+                    if (_comp(KeyOfValue()(x->_data), key))
+                    {
+                        r += node_type::subtree_size(x->_left) + 1;
+                        x = x->_right;
+                    }
+                    else
+                        x = x->_left;
+                }
+                return r;
+            }
 
     
             void swap(rbtree &x)
             {
                 ft::swap(_node_alloc, x._node_alloc);
                 ft::swap(_root, x._root);
-                ft::swap(_TNULL, x._TNULL);
+                ft::swap(_header, x._header);
+                ft::swap(_leftmost, x._leftmost);
                 ft::swap(_comp, x._comp);
                 ft::swap(_node_cnt, x._node_cnt);
             }
 
-            // insert node in rb
-            node_ptr _rb_insert(const value_type &data)
+                // insert only if no node with an equivalent key exists
+                // (one descent : the duplicate check and the slot search share it)
+            ft::pair<node_ptr, bool> _insert_unique(const value_type &data)
             {
-                ++_node_cnt;
-                node_ptr temp = _insert_node(data);
-                _TNULL->_parent = _root;
-                return temp;
+                node_ptr parent;
+                bool left;
+                node_ptr temp = _find_unique_pos(KeyOfValue()(data), parent, left);
+
+                if (temp)
+                    return ft::pair<node_ptr, bool>(temp, false);
+                return ft::pair<node_ptr, bool>(_insert_at(parent, left, data), true);
             }
-                // insertNode
-            node_ptr _insert_node(const value_type &data)
+                // returns the node holding key, or NULL and the slot where key belongs
+                // (lets the caller build the value only when it is really inserted)
+            node_ptr _find_unique_pos(const key_type &key, node_ptr &parent, bool &left) const
             {
-                node_ptr z = _getnode(node_type(NULL, _TNULL, _TNULL, data, RED));
-                node_ptr y = NULL;
                 node_ptr x = _root;
+                node_ptr prev = NULL; // last node whose key is not greater than key
 
-                if (_root->_color == RED)
-                {
-                    _node_alloc.destroy(_root);
-                    _node_alloc.deallocate(_root, 1);
-                    _root = z;
-                    _root->_color = BLACK;
-                    return z;
-                }
-
-                while (x != _TNULL)
+                parent = NULL;
+                left = true;
+                while (x != NULL)
                 {
-                    y = x;
-                    // data < x->data
-                    if (_comp( KeyOfValue()(z->_data), KeyOfValue()(x->_data)))
+                    parent = x;
+                    left = _comp(key, KeyOfValue()(x->_data));
+                    if (left)
                         x = x->_left;
                     else
+                    {
+                        prev = x;
                         x = x->_right;
+                    }
                 }
+                if (prev && !_comp(KeyOfValue()(prev->_data), key))
+                    return prev;
+                return NULL;
+            }
+                // same as _insert_unique, hint being a node (or the header) close to where data belongs
+            node_ptr _insert_hint_unique(node_ptr hint, const value_type &data)
+            {
+                node_ptr parent;
+                bool left;
+                node_ptr temp = _find_hint_unique_pos(hint, KeyOfValue()(data), parent, left);
 
-                z->_parent = y;
-                if (y == NULL)
-                    _root = z;
-                else if (_comp( KeyOfValue()(z->_data), KeyOfValue()(y->_data)))
-                    y->_left = z;
-                else
-                    y->_right = z;
-                if (z == _root)
+                if (temp)
+                    return temp;
+                return _insert_at(parent, left, data);
+            }
+                // when key fits right before or right after hint, the slot is
+                // a free child of hint or of its neighbour : no descent needed.
+                // otherwise falls back on _find_unique_pos
+            node_ptr _find_hint_unique_pos(node_ptr hint, const key_type &key, node_ptr &parent, bool &left) const
+            {
+                if (hint == _header)
                 {
-                    z->_color = BLACK;
-                    return z;
+                    // end() : appending after the maximum
+                    if (_node_cnt > 0)
+                    {
+                        node_ptr last = _header->_right;
+                        if (_comp(KeyOfValue()(last->_data), key))
+                        {
+                            parent = last;
+                            left = false;
+                            return NULL;
+                        }
+                    }
+                    return _find_unique_pos(key, parent, left);
                 }
-                if (z->_parent== _root)
-                    return z;
-                _insert_fix(z);
-                return z; 
+                if (_comp(key, KeyOfValue()(hint->_data)))
+                {
+                    // key < hint : try between predecessor and hint
+                    if (hint == _leftmost)
+                    {
+                        parent = hint;
+                        left = true;
+                        return NULL;
+                    }
+                    node_ptr before = iterator(hint).decrement(hint);
+                    if (_comp(KeyOfValue()(before->_data), key))
+                    {
+                        // hint and its predecessor are adjacent : one of them has a free slot
+                        left = (hint->_left == NULL);
+                        parent = left ? hint : before;
+                        return NULL;
+                    }
+                    return _find_unique_pos(key, parent, left);
+                }
+                if (_comp(KeyOfValue()(hint->_data), key))
+                {
+                    // hint < key : try between hint and successor
+                    node_ptr after = iterator(hint)._increment(hint);
+                    if (after == _header || _comp(key, KeyOfValue()(after->_data)))
+                    {
+                        left = (hint->_right != NULL);
+                        parent = left ? after : hint;
+                        return NULL;
+                    }
+                    return _find_unique_pos(key, parent, left);
+                }
+                // equivalent key
+                return hint;
+            }
+                // range insert : an empty tree fed with a sorted range is built bottom-up in O(n),
+                // anything else goes through _insert_unique one element at a time
+                // (the sorted check reads the range twice : forward iterators only)
+            template <typename InputIterator>
+            void _insert_range_unique(InputIterator first, InputIterator last)
+            {
+                typedef typename ft::iterator_traits<InputIterator>::iterator_category category;
+
+                _insert_range_unique(first, last, ft::integral_constant<bool, ft::is_single_pass<category>::value>());
+            }
+            template <typename InputIterator>
+            void _insert_range_unique(InputIterator first, InputIterator last, ft::true_type)
+            {
+                for (; first != last; ++first)
+                    _insert_unique(*first);
+            }
+            template <typename InputIterator>
+            void _insert_range_unique(InputIterator first, InputIterator last, ft::false_type)
+            {
+                size_type n;
+
+                if (_node_cnt == 0 && _sorted_range_count(first, last, n))
+                {
+                    if (n == 0)
+                        return ;
+                    // nodes on the deepest, incomplete level are RED, every other node is BLACK
+                    size_type red_depth = 0;
+                    for (size_type m = n + 1; m > 1; m >>= 1)
+                        ++red_depth;
+                    _root = _build_sorted(first, last, n, 0, red_depth, NULL);
+                    _node_cnt = n;
+                    _update_header();
+                    return ;
+                }
+                for (; first != last; ++first)
+                    _insert_unique(*first);
+            }
+                // insert data in the slot returned by _find_unique_pos
+            node_ptr _insert_at(node_ptr parent, bool left, const value_type &data)
+            {
+                node_ptr temp = _attach_node(parent, left, data);
+                ++_node_cnt; // counted once the node exists : a throwing copy leaves the size as it was
+                _header->set_parent(_root);
+                return temp;
             }
             // delete node in rbtree
             void _rb_delete(const node_ptr &x)
+            {
+                _extract(x);
+                _putnode(x);
+            }
+                // unlink x from the tree, the node is kept alive for the caller
+            void _extract(node_ptr x)
             {
                 --_node_cnt;
-                _delete_node(x);
-                _TNULL->_parent = _root;
+                // neighbours become the new extremes (the header when x was the last node)
+                if (x == _leftmost)
+                    _leftmost = iterator(x)._increment(x);
+                if (x == _header->_right)
+                    _header->_right = (_leftmost == _header) ? _header : iterator(x).decrement(x);
+                _unlink_node(x);
+                _header->set_parent(_root);
+            }
+                // erase [first, last) : the span is cut out with two splits and the
+                // remaining halves are joined back, O(log n) rebalancing + one free per node
+            void _erase_range(node_ptr first, node_ptr last)
+            {
+                if (first == last)
+                    return ;
+                if (last == _header && first == _leftmost)
+                {
+                    this->clear();
+                    return ;
+                }
+                // short spans : plain deletes are cheaper than split/join
+                node_ptr it = first;
+                for (int i = 0; i < 16 && it != last; ++i)
+                    it = iterator(it)._increment(it);
+                if (it == last)
+                {
+                    while (first != last)
+                    {
+                        it = iterator(first)._increment(first);
+                        _rb_delete(first);
+                        first = it;
+                    }
+                    return ;
+                }
+
+                node_ptr left, mid, right;
+                size_type lh, mh, rh;
+                _split(_root, _black_height(_root), KeyOfValue()(first->_data), left, lh, right, rh);
+                if (last == _header)
+                    mid = right, right = NULL;
+                else
+                    _split(right, rh, KeyOfValue()(last->_data), mid, mh, right, rh);
+                _node_cnt -= _destroy_subtree(mid);
+                _root = _join(left, right);
+                _update_header();
+            }
+                // move the keys not less than key into x (its content is dropped) :
+                // one split, O(log n). the subtree sizes give both counts, without them
+                // the smaller half is counted, O(log n + min(size(), x.size()))
+                // (nodes change trees, the two allocators have to be interchangeable)
+            void _split_off(const key_type &key, rbtree &x)
+            {
+                node_ptr left, right;
+                size_type lh, rh;
+
+                x.clear();
+                x._comp = _comp;
+                _split(_root, _black_height(_root), key, left, lh, right, rh);
+                _root = left;
+                _update_header();
+                x._root = right;
+                x._update_header();
+                _split_counts(x, ft::integral_constant<bool, node_type::counted>());
+            }
+            void _split_counts(rbtree &x, ft::true_type)
+            {
+                _node_cnt = node_type::subtree_size(_root);
+                x._node_cnt = node_type::subtree_size(x._root);
+            }
+                // both halves walked in step until the smaller one ends
+            void _split_counts(rbtree &x, ft::false_type)
+            {
+                size_type total = _node_cnt;
+                size_type n = 0;
+                const_iterator a = begin(), b = x.begin();
+
+                for (; a != end() && b != x.end(); ++a, ++b)
+                    ++n;
+                _node_cnt = (a == end()) ? n : total - n;
+                x._node_cnt = total - _node_cnt;
             }
-			// deleteNode
-			bool _delete_node(const node_ptr &z)
+                // move the nodes of x whose key is not in this tree, x keeps the others.
+                // when every key of x is greater (or less) than every key here,
+                // the two trees are joined in O(log n), otherwise the nodes are relinked one by one
+            void _merge_unique(rbtree &x)
+            {
+                if (this == &x || x._node_cnt == 0)
+                    return ;
+                if (_node_cnt == 0 || _comp(KeyOfValue()(_header->_right->_data), KeyOfValue()(x._leftmost->_data)))
+                    _root = _join(_root, x._root);
+                else if (_comp(KeyOfValue()(x._header->_right->_data), KeyOfValue()(_leftmost->_data)))
+                    _root = _join(x._root, _root);
+                else
+                {
+                    for (node_ptr z = x._leftmost; z != x._header; )
+                    {
+                        node_ptr next = iterator(z)._increment(z);
+                        node_ptr parent;
+                        bool left;
+
+                        if (_find_unique_pos(KeyOfValue()(z->_data), parent, left) == NULL)
+                        {
+                            x._extract(z);
+                            ++_node_cnt;
+                            _link_node(parent, left, z);
+                            _header->set_parent(_root);
+                        }
+                        z = next;
+                    }
+                    return ;
+                }
+                _node_cnt += x._node_cnt;
+                _update_header();
+                x._root = NULL;
+                x._node_cnt = 0;
+                x._update_header();
+            }
+                // unlink z from the tree and rebalance, z itself is not freed
+                // x may be a NULL leaf, so its parent is tracked in x_parent
+			void _unlink_node(node_ptr z)
 			{
-				node_ptr x, y;
+				node_ptr x, x_parent, y;
                 y = z;
-				int y_original_color = y->_color;
-				if (z->_left == _TNULL)
+				int y_original_color = y->color();
+				if (z->_left == NULL)
 				{
 					x = z->_right;
+					x_parent = z->parent();
 					_rb_transplant(z, z->_right);
 				}
-				else if (z->_right == _TNULL)
+				else if (z->_right == NULL)
 				{
 					x = z->_left;
+					x_parent = z->parent();
 					_rb_transplant(z,z->_left);
 				}
 				else
 				{
 					y = node_type::tree_minimum(z->_right);
-					y_original_color = y->_color;
+					y_original_color = y->color();
 					x = y->_right;
-					if (y->_parent == z)
-						x->_parent = y;
+					if (y->parent() == z)
+						x_parent = y;
 					else
 					{
+						x_parent = y->parent();
 						_rb_transplant(y, y->_right);
 						y->_right = z->_right;
-						y->_right->_parent = y;
+						y->_right->set_parent(y);
 					}
 					_rb_transplant(z,y);
 					y->_left = z->_left;
-					y->_left->_parent = y;
-					y->_color = z->_color;
+					y->_left->set_parent(y);
+					y->set_color(z->color());
+					y->copy_size(*z);
 				}
-                _node_alloc.destroy(z);
-				_node_alloc.deallocate(z, 1);
+				// one node less under x_parent and above (y, if it moved, is on that path)
+				_count_up(x_parent, false);
 				if (y_original_color == BLACK)
-					_delete_fix(x);
-				return true;
+					_delete_fix(x, x_parent);
 			}
                         
                 // get_root
@@ -328,10 +787,10 @@ namespace ft
             {
                 return _root;
             }
-                // getTNULL
-            const node_ptr &getTNULL() const
+                // get_header
+            const node_ptr &get_header() const
             {
-                return _TNULL;
+                return _header;
             }
             
             size_type size() const
@@ -343,53 +802,386 @@ namespace ft
                 return (_node_alloc.max_size() < PTRDIFF_MAX) ? _node_alloc.max_size() : PTRDIFF_MAX;
                 // return (_alloc.max_size() / 5);
             }
+                // frees every node in one post-order walk, no rebalancing
+            allocator_type get_allocator() const
+            {
+                return allocator_type(_node_alloc);
+            }
+            key_compare key_comp() const
+            {
+                return _comp;
+            }
+            void clear()
+            {
+                _destroy_subtree(_root);
+                _root = NULL;
+                _node_cnt = 0;
+                _update_header();
+            }
 
         private:
             // Private member functions
+                // true if keys in [first, last) never decrease, n is then the number of distinct keys
+            template <typename InputIterator>
+            bool _sorted_range_count(InputIterator first, InputIterator last, size_type &n) const
+            {
+                n = 0;
+                if (first == last)
+                    return true;
+                InputIterator prev = first;
+                for (n = 1, ++first; first != last; prev = first, ++first)
+                {
+                    if (_comp(KeyOfValue()(*first), KeyOfValue()(*prev)))
+                        return false;
+                    if (_comp(KeyOfValue()(*prev), KeyOfValue()(*first)))
+                        ++n;
+                }
+                return true;
+            }
+                // balanced subtree of the next n distinct keys of a sorted range (median as root)
+            template <typename InputIterator>
+            node_ptr _build_sorted(InputIterator &first, InputIterator last, size_type n,
+                                    size_type depth, size_type red_depth, node_ptr parent)
+            {
+                if (n == 0)
+                    return NULL;
+                size_type left_n = n / 2;
+                node_ptr left = _build_sorted(first, last, left_n, depth + 1, red_depth, NULL);
+                node_ptr x = _getnode(*first, parent, left, NULL, depth == red_depth ? RED : BLACK);
+
+                if (left != NULL)
+                    left->set_parent(x);
+                // equivalent keys : the first one wins, like _insert_unique
+                InputIterator prev = first;
+                for (++first; first != last && !_comp(KeyOfValue()(*prev), KeyOfValue()(*first)); ++first)
+                    ;
+                x->_right = _build_sorted(first, last, n - 1 - left_n, depth + 1, red_depth, x);
+                x->set_size(n);
+                return x;
+            }
+                // returns the number of freed nodes
+            size_type _destroy_subtree(node_ptr x)
+            {
+                size_type n = 0;
+
+                while (x != NULL)
+                {
+                    // recurse on the right, loop on the left : depth stays O(log n)
+                    n += _destroy_subtree(x->_right);
+                    node_ptr y = x->_left;
+                    _putnode(x);
+                    x = y;
+                    ++n;
+                }
+                return n;
+            }
+                // split / join work on standalone subtrees (root has no parent, NULL when empty)
+                // and use _root as scratch space for the rotations of _insert_fix / _delete_fix
+                // black heights are passed along instead of walked again : a split joins once per level
+                // number of BLACK nodes from x down to a leaf
+            size_type _black_height(node_ptr x) const
+            {
+                size_type h = 0;
+
+                for (; x != NULL; x = x->_left)
+                    if (x->color() == BLACK)
+                        ++h;
+                return h;
+            }
+                // black height of x once _make_root recolors it, h counts x with its current color
+            static size_type _root_height(node_ptr x, size_type h)
+            {
+                return (x != NULL && x->color() == RED) ? h + 1 : h;
+            }
+                // detach the subtree rooted at x as a valid red-black tree
+            node_ptr _make_root(node_ptr x)
+            {
+                if (x != NULL)
+                {
+                    x->set_parent_color(NULL, BLACK);
+                }
+                return x;
+            }
+                // every key of l < key of k < every key of r, lh / rh are their black heights
+                // as roots and height gets the one of the result : O(|lh - rh| + 1)
+            node_ptr _join(node_ptr l, size_type lh, node_ptr k, node_ptr r, size_type rh, size_type &height)
+            {
+                l = _make_root(l);
+                r = _make_root(r);
+
+                if (lh == rh)
+                {
+                    _link(k, l, r, NULL, BLACK);
+                    k->update_size();
+                    height = lh + 1;
+                    return k;
+                }
+                bool side = (lh > rh); // true : r hangs on the right spine of l
+                size_type h = side ? lh : rh;
+                size_type target = side ? rh : lh;
+                node_ptr c = side ? l : r;
+                node_ptr p = NULL;
+
+                // first BLACK node of the spine with the black height of the other tree
+                while (c != NULL && (c->color() == RED || h > target))
+                {
+                    if (c->color() == BLACK)
+                        --h;
+                    p = c;
+                    c = side ? c->_right : c->_left;
+                }
+                if (side)
+                {
+                    p->_right = k;
+                    _link(k, c, r, p, RED);
+                    _root = l;
+                }
+                else
+                {
+                    p->_left = k;
+                    _link(k, l, c, p, RED);
+                    _root = r;
+                }
+                _update_size_up(k);
+                height = (side ? lh : rh) + _insert_fix(k);
+                return _root;
+            }
+                // every key of l < every key of r
+            node_ptr _join(node_ptr l, node_ptr r)
+            {
+                if (l == NULL)
+                    return _make_root(r);
+                if (r == NULL)
+                    return _make_root(l);
+                l = _make_root(l);
+                _root = _make_root(r);
+                node_ptr k = node_type::tree_minimum(_root);
+                _unlink_node(k);
+                size_type h;
+                return _join(l, _black_height(l), k, _root, _black_height(_root), h);
+            }
+                // l gets the keys less than key, r the others, O(log n) :
+                // th is the black height of t (t counted with its color), lh / rh get the ones of l / r
+            void _split(node_ptr t, size_type th, const key_type &key, node_ptr &l, size_type &lh, node_ptr &r, size_type &rh)
+            {
+                if (t == NULL)
+                {
+                    l = NULL;
+                    r = NULL;
+                    lh = 0;
+                    rh = 0;
+                    return ;
+                }
+                node_ptr a, b;
+                size_type ah, bh;
+                size_type ch = (t->color() == BLACK) ? th - 1 : th;
+                if (_comp(KeyOfValue()(t->_data), key))
+                {
+                    size_type left_h = _root_height(t->_left, ch);
+                    _split(t->_right, ch, key, a, ah, b, bh);
+                    l = _join(t->_left, left_h, t, a, ah, lh);
+                    r = b;
+                    rh = bh;
+                }
+                else
+                {
+                    size_type right_h = _root_height(t->_right, ch);
+                    _split(t->_left, ch, key, a, ah, b, bh);
+                    l = a;
+                    lh = ah;
+                    r = _join(b, bh, t, t->_right, right_h, rh);
+                }
+            }
+            void _link(node_ptr k, node_ptr left, node_ptr right, node_ptr parent, int color)
+            {
+                k->_left = left;
+                k->_right = right;
+                k->set_parent_color(parent, color);
+                if (left != NULL)
+                    left->set_parent(k);
+                if (right != NULL)
+                    right->set_parent(k);
+            }
+                // recount the subtree sizes from x up to the root (NULL parent or the header)
+            void _update_size_up(node_ptr x)
+            {
+                if (!node_type::counted)
+                    return ;
+                for (; x != NULL && x != _header; x = x->parent())
+                    x->update_size();
+            }
+                // one node more (grow) or less under every node from x up to the root :
+                // unlike _update_size_up, only the nodes of the path are touched
+            void _count_up(node_ptr x, bool grow)
+            {
+                if (!node_type::counted)
+                    return ;
+                for (; x != NULL && x != _header; x = x->parent())
+                    x->count(grow);
+            }
+                // root and extremes after a bulk change of the tree
+            void _update_header()
+            {
+                _header->set_parent(_root);
+                if (_root == NULL)
+                {
+                    _leftmost = _header;
+                    _header->_right = _header;
+                }
+                else
+                {
+                    _root->set_parent(_header);
+                    _leftmost = node_type::tree_minimum(_root);
+                    _header->_right = node_type::tree_maximum(_root);
+                }
+            }
+                // copy x into this (empty) tree, same shape and colors.
+                // if a value copy throws, the tree is left empty
+            void _copy_from(const rbtree &x)
+            {
+                if (x._node_cnt == 0)
+                    return ;
+                _root = _clone(x._root, NULL);
+                _node_cnt = x._node_cnt;
+                _update_header();
+            }
+                // on a throw, the nodes cloned so far are freed before rethrowing
+            node_ptr _clone(const_node_ptr x, node_ptr parent)
+            {
+                if (x == NULL)
+                    return NULL;
+                node_ptr top = _getnode(x->_data, parent, NULL, NULL, x->color());
+                top->copy_size(*x);
+                try
+                {
+                    top->_left = _clone(x->_left, top);
+                    top->_right = _clone(x->_right, top);
+                }
+                catch (...)
+                {
+                    _destroy_subtree(top);
+                    throw;
+                }
+                return top;
+            }
+                // link a new RED node as the left/right child of parent (root if NULL) and rebalance
+            node_ptr _attach_node(node_ptr parent, bool left, const value_type &data)
+            {
+                node_ptr z = _getnode(data, NULL, NULL, NULL, RED);
+
+                _link_node(parent, left, z);
+                return z;
+            }
+                // same with a node that already holds its value (taken from another tree)
+            void _link_node(node_ptr parent, bool left, node_ptr z)
+            {
+                z->set_parent_color(parent ? parent : _header, RED);
+                z->_left = NULL;
+                z->_right = NULL;
+                z->set_size(1);
+                if (parent == NULL)
+                {
+                    _root = z;
+                    _leftmost = z;
+                    _header->_right = z;
+                }
+                else if (left)
+                {
+                    parent->_left = z;
+                    if (parent == _leftmost)
+                        _leftmost = z;
+                }
+                else
+                {
+                    parent->_right = z;
+                    if (parent == _header->_right)
+                        _header->_right = z;
+                }
+                _count_up(parent, true);
+                _insert_fix(z);
+            }
+                // descend from x, y is the best candidate found so far
+            template <typename K>
+            node_ptr _lower_bound(node_ptr x, node_ptr y, const K &key) const
+            {
+                while (x != NULL)
+                {
+                    if (!_comp(KeyOfValue()(x->_data), key))
+                    {
+                        y = x;
+                        x = x->_left;
+                    }
+                    else
+                        x = x->_right;
+                }
+                return y;
+            }
+            template <typename K>
+            node_ptr _upper_bound(node_ptr x, node_ptr y, const K &key) const
+            {
+                while (x != NULL)
+                {
+                    if (_comp(key, KeyOfValue()(x->_data)))
+                    {
+                        y = x;
+                        x = x->_left;
+                    }
+                    else
+                        x = x->_right;
+                }
+                return y;
+            }
 			    // *Transplant => 삭제 시 이용하며, 삭제할 노드의 자식 노드를 부모노드에 연결해주는 함수
+			    // (the root's parent is the header, or NULL inside split / join)
 			void _rb_transplant(node_ptr u, node_ptr v)
 			{
-				if (u->_parent == NULL)
+				if (u == _root)
 					_root = v;
-				else if (u == u->_parent->_left)
-					u->_parent->_left = v;
+				else if (u == u->parent()->_left)
+					u->parent()->_left = v;
 				else
-					u->_parent->_right = v;
-				v->_parent = u->_parent;
+					u->parent()->_right = v;
+				if (v != NULL)
+					v->set_parent(u->parent());
 			}
 
             void _left_rotate(node_ptr x)
             {
                 node_ptr y = x->_right;
                 x->_right = y->_left;
-                if (y->_left != _TNULL)
-                    y->_left->_parent = x;
-                y->_parent = x->_parent;
-                if (x->_parent == NULL)
+                if (y->_left != NULL)
+                    y->_left->set_parent(x);
+                y->set_parent(x->parent());
+                if (x == _root)
                     _root = y;
-                else if (x == x->_parent->_left)
-                    x->_parent->_left = y;
+                else if (x == x->parent()->_left)
+                    x->parent()->_left = y;
                 else
-                    x->_parent->_right = y;
+                    x->parent()->_right = y;
                 y->_left = x;
-                x->_parent = y;
+                x->set_parent(y);
+                // y takes over x's subtree, x lost y and y's right subtree
+                y->copy_size(*x);
+                x->update_size();
             }
 
             void _right_rotate(node_ptr x)
             {
                 node_ptr y = x->_left;
                 x->_left = y->_right;
-                if (y->_right != _TNULL)
-                    y->_right->_parent = x;
-                y->_parent = x->_parent;
-                if (x->_parent == NULL)
+                if (y->_right != NULL)
+                    y->_right->set_parent(x);
+                y->set_parent(x->parent());
+                if (x == _root)
                     _root = y;
-                else if (x == x->_parent->_right)
-                    x->_parent->_right = y;
+                else if (x == x->parent()->_right)
+                    x->parent()->_right = y;
                 else
-                    x->_parent->_left = y;
+                    x->parent()->_left = y;
                 y->_right = x;
-                x->_parent = y;
+                x->set_parent(y);
+                y->copy_size(*x);
+                x->update_size();
             }
             /**
              * @brief rbtree_insert_rebalance
@@ -400,87 +1192,99 @@ namespace ft
              * @param root root node
              */
 
-            void _insert_fix(node_ptr k)
+                // returns true when the black height of the tree grew
+            bool _insert_fix(node_ptr k)
             {
                 // k->_color = RED; // new node => RED
                 // RB-tree의 조건을 만족할 동안 (Double Red)
-                while( k != _root && k->_parent->_color == RED)
+                while( k != _root && k->parent()->color() == RED)
                 {
                     // if parent is left child of grandparent, side is true else side is false
-                    bool side = (k->_parent == k->_parent->_parent->_left); // x의 parent가 GrandParent의 왼쪽 자식인 경우
+                    bool side = (k->parent() == k->parent()->parent()->_left); // x의 parent가 GrandParent의 왼쪽 자식인 경우
                     
                     // set uncle node
-                    node_ptr u = side ? k->_parent->_parent->_right : k->_parent->_parent->_left;
+                    node_ptr u = side ? k->parent()->parent()->_right : k->parent()->parent()->_left;
                     
                     // Case 1
-                    if (u->_color == RED)
+                    if (u != NULL && u->color() == RED)
                     {
                         // if uncle's color is RED -> recoloring
-                        u->_color = BLACK;
-                        k->_parent->_color = BLACK;
-                        k->_parent->_parent->_color = RED;
-                        k = k->_parent->_parent; // GrandParent를 기준으로 다시 검사
+                        u->set_color(BLACK);
+                        k->parent()->set_color(BLACK);
+                        k->parent()->parent()->set_color(RED);
+                        k = k->parent()->parent(); // GrandParent를 기준으로 다시 검사
                     }
                     // Case 2-1
                     else // Uncle node => BLACK
                     {
                         // if uncle is not exist or uncle's color is BLACK -> restructuring
-                        if ( k == (side ? k->_parent->_right : k->_parent->_left))
+                        if ( k == (side ? k->parent()->_right : k->parent()->_left))
                         {
-                            k = k->_parent;
+                            k = k->parent();
                             side ? _left_rotate(k) : _right_rotate(k);
                         }
-                        k->_parent->_color = BLACK;
-                        k->_parent->_parent->_color = RED;
-                        side ? _right_rotate(k->_parent->_parent) : _left_rotate(k->_parent->_parent);
+                        k->parent()->set_color(BLACK);
+                        k->parent()->parent()->set_color(RED);
+                        side ? _right_rotate(k->parent()->parent()) : _left_rotate(k->parent()->parent());
                     }
                 }
-                _root->_color = BLACK;
+                // a RED root means Case 1 went all the way up : one more BLACK on every path
+                bool grew = (_root->color() == RED);
+                _root->set_color(BLACK);
+                return grew;
+            }
+
+                // NULL leaves are BLACK
+            static bool _is_black(node_ptr x)
+            {
+                return x == NULL || x->color() == BLACK;
             }
 
-            void _delete_fix(node_ptr x)
+            void _delete_fix(node_ptr x, node_ptr x_parent)
             {
-                while (x != _root && x->_color == BLACK)
+                while (x != _root && _is_black(x))
                 {
                     // if x is left child, side is true else side is false
-                    bool side = (x == x->_parent->_left);
+                    // (x may be NULL, its sibling never is)
+                    bool side = (x == x_parent->_left);
                     // set sibling node
-                    node_ptr s = side ? x->_parent->_right : x->_parent->_left;
+                    node_ptr s = side ? x_parent->_right : x_parent->_left;
 
                     // case 1
-                    if (s->_color == RED)
+                    if (s->color() == RED)
                     {
-                        s->_color = BLACK;
-                        x->_parent->_color = RED;
-                        side ? _left_rotate(x->_parent) : _right_rotate(x->_parent);
-                        s = side ? x->_parent->_right : x->_parent->_left;
+                        s->set_color(BLACK);
+                        x_parent->set_color(RED);
+                        side ? _left_rotate(x_parent) : _right_rotate(x_parent);
+                        s = side ? x_parent->_right : x_parent->_left;
                     }
                     // case 2
-                    if (s->_left->_color == BLACK && s->_right->_color == BLACK)
+                    if (_is_black(s->_left) && _is_black(s->_right))
                     {
-                        s->_color = RED;
-                        x = x->_parent;
+                        s->set_color(RED);
+                        x = x_parent;
+                        x_parent = x_parent->parent();
                     }
                     else
                     {
                         // case 3
-                        if ((side ? s->_right->_color : s->_left->_color) == BLACK)
+                        if (_is_black(side ? s->_right : s->_left))
                         {
-                            (side ? s->_left->_color : s->_right->_color) = BLACK;
-                            s->_color = RED;
+                            (side ? s->_left : s->_right)->set_color(BLACK);
+                            s->set_color(RED);
                             side ? _right_rotate(s) : _left_rotate(s);
-                            s = side ? x->_parent->_right : x->_parent->_left;
+                            s = side ? x_parent->_right : x_parent->_left;
                         }
                         // case 4
-                        s->_color = x->_parent->_color;
-                        x->_parent->_color = BLACK;
-                        (side ? s->_right->_color : s->_left->_color) = BLACK;
-                        side ? _left_rotate(x->_parent) : _right_rotate(x->_parent);
+                        s->set_color(x_parent->color());
+                        x_parent->set_color(BLACK);
+                        (side ? s->_right : s->_left)->set_color(BLACK);
+                        side ? _left_rotate(x_parent) : _right_rotate(x_parent);
                         x = _root;
                     }
                 }
-                x->_color = BLACK;
-                _root->_color = BLACK;
+                if (x != NULL)
+                    x->set_color(BLACK);
 		    }
     };
 
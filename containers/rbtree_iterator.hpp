@@ -14,17 +14,21 @@
 
 namespace ft
 {
-    template <typename T> 
+    // node augmentation, last template parameter of map / set (see rbtree_node_count)
+    struct plain_nodes {};
+    struct order_statistics {};     // subtree sizes : find_by_order, order_of_key, it + n
+
+    template <typename T, typename Augment>
     struct rbtree_node;
 
-    template<typename T>
+    template<typename T, typename Augment = plain_nodes>
     class rbtree_iterator
     {
         public:
             typedef ft::bidirectional_iterator_tag iterator_category;
             typedef std::ptrdiff_t                      difference_type;
-            typedef ft::rbtree_iterator<T> _Self;
-            typedef ft::rbtree_node<T> node_type;
+            typedef ft::rbtree_iterator<T, Augment> _Self;
+            typedef ft::rbtree_node<T, Augment> node_type;
             typedef typename node_type::node_ptr node_ptr;
 
             typedef T   value_type;
@@ -46,12 +50,12 @@ namespace ft
             }
 
             template <typename U>    // copy
-            rbtree_iterator(const rbtree_iterator<U> &x)
+            rbtree_iterator(const rbtree_iterator<U, Augment> &x)
             : _node(x._node)
             {}
 
             template <typename U>      // copy assignment
-            _Self &operator=(const rbtree_iterator<U> &x)
+            _Self &operator=(const rbtree_iterator<U, Augment> &x)
             {
                 _node = x._node;
                 return *this;
@@ -63,8 +67,6 @@ namespace ft
             //     return *this;
             // }
 
-            virtual ~rbtree_iterator() {}
-
             //
             reference operator*() const
             {
@@ -79,23 +81,22 @@ namespace ft
 			node_ptr _increment(node_ptr x)
 			{
 				// Case 1: right child exist, return leftmost node
-				if (!node_type::isTNULL(x->_right))
+				if (x->_right)
 				{
 					return node_type::tree_minimum(x->_right);
 				}
-				// backup _TNULL
-				node_ptr _TNULL = x->_right;
-				// Case 2: up until it came from left
-				while (x->_parent)
+				// Case 2: up until it came from left (the root's parent is the header)
+				node_ptr y = x->parent();
+				while (x == y->_right)
 				{
-					if (x->_parent->_left == x)
-					{
-						return x->_parent;
-					}
-					x = x->_parent;
+					x = y;
+					y = y->parent();
 				}
-				// Case 3: return TNULL
-				return _TNULL;
+				// y is the successor, unless the root is the rightmost node :
+				// the climb then overshoots to the root and x already is the header
+				if (x->_right != y)
+					x = y;
+				return x;
 			}
 
             _Self &operator++()
@@ -113,29 +114,25 @@ namespace ft
            
             node_ptr decrement(node_ptr _node)
             {
-            // case header
-            if (node_type::isTNULL(_node))
-            {
-                // node_type::tree_maximum(_node->_parent);
-                return node_type::tree_maximum(_node->_parent);
-            }
-            // 왼쪽 자식이 존재 할땐 부모의 오른쪽 자식 리턴하면 이함수에서 찾는 값이 충족 된다.
-            if (!node_type::isTNULL(_node->_left))
-            {
-                // node_type::tree_maximum(_node->_left);
-                return node_type::tree_maximum(_node->_left);
-            }
-
-            while (_node->_parent)
-            {
-                if (_node->_parent->_right == _node) // ㄴㅐ가 오른쪽 자식일때는 부모로 올로가는거. 
+                // case header
+                if (_node->is_header())
                 {
-                    return _node->_parent;
+                    // end() keeps the rightmost node in _right
+                    return _node->_right;
                 }
-                _node = _node->_parent;
+                // 왼쪽 자식이 존재 할땐 부모의 오른쪽 자식 리턴하면 이함수에서 찾는 값이 충족 된다.
+                if (_node->_left)
+                {
+                    return node_type::tree_maximum(_node->_left);
+                }
+                node_ptr y = _node->parent();
+                while (_node == y->_left) // 내가 왼쪽 자식일때는 부모로 올라가는거.
+                {
+                    _node = y;
+                    y = _node->parent();
+                }
+                return y;
             }
-            return NULL;
-        }
 
             _Self &operator--()
             {
@@ -150,6 +147,32 @@ namespace ft
                 return temp;
             }
 
+                // O(log n) jumps through the subtree sizes (see rbtree_node::advance),
+                // order_statistics trees only, the category stays bidirectional
+            _Self &operator+=(difference_type n)
+            {
+                _node = node_type::advance(_node, n);
+                return *this;
+            }
+            _Self &operator-=(difference_type n)
+            {
+                _node = node_type::advance(_node, -n);
+                return *this;
+            }
+            _Self operator+(difference_type n) const
+            {
+                return _Self(node_type::advance(_node, n));
+            }
+            _Self operator-(difference_type n) const
+            {
+                return _Self(node_type::advance(_node, -n));
+            }
+            difference_type operator-(const _Self &x) const
+            {
+                return static_cast<difference_type>(node_type::rank(_node))
+                    - static_cast<difference_type>(node_type::rank(x._node));
+            }
+
             
             node_ptr base() const
             {
@@ -157,14 +180,14 @@ namespace ft
             }
 
     };
-    template <typename Value>
-    bool operator==(const rbtree_iterator<Value>& lhs, const rbtree_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator==(const rbtree_iterator<Value, Augment>& lhs, const rbtree_iterator<Value, Augment>& rhs)
     {
         return (rhs.base() == lhs.base());
     }
 
-    template <typename Value>
-    bool operator!=(const rbtree_iterator<Value>& lhs, const rbtree_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator!=(const rbtree_iterator<Value, Augment>& lhs, const rbtree_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() != rhs.base());
     }
@@ -172,14 +195,14 @@ namespace ft
 
 
     //rbtree_const_iterator
-    template<class T>
+    template<class T, class Augment = plain_nodes>
     class rbtree_const_iterator
     {
     public:
         typedef ft::bidirectional_iterator_tag iterator_category;
         typedef std::ptrdiff_t                     difference_type;
-        typedef rbtree_const_iterator<T> _Self;
-        typedef ft::rbtree_node<T> node_type;
+        typedef rbtree_const_iterator<T, Augment> _Self;
+        typedef ft::rbtree_node<T, Augment> node_type;
         typedef typename node_type::const_node_ptr node_ptr;
 
         typedef T   value_type;
@@ -201,16 +224,16 @@ namespace ft
         {}
 
         template <class U>    // copy
-        rbtree_const_iterator(const rbtree_const_iterator<U> &x)
+        rbtree_const_iterator(const rbtree_const_iterator<U, Augment> &x)
         : _node(x._node)
         {}
         template <class U>    // copy
-        rbtree_const_iterator(const rbtree_iterator<U> &x)
+        rbtree_const_iterator(const rbtree_iterator<U, Augment> &x)
         : _node(x._node)
         {}
 
         template <class U>      // copy assignment
-        _Self &operator=(const rbtree_const_iterator<U> &x)
+        _Self &operator=(const rbtree_const_iterator<U, Augment> &x)
         {
             if (this!= &x)
                 _node = x._node;
@@ -218,13 +241,12 @@ namespace ft
         }
 
         template <typename U>
-        _Self& operator=(const rbtree_iterator<U>& it)
+        _Self& operator=(const rbtree_iterator<U, Augment>& it)
         {
             if (this != &it)
                 _node = it._node;
             return *this;
         }
-        virtual ~rbtree_const_iterator() {}
 
         //
         reference operator*() const
@@ -240,23 +262,22 @@ namespace ft
         node_ptr _increment(node_ptr x)
         {
             // Case 1: right child exist, return leftmost node
-            if (!node_type::isTNULL(x->_right))
+            if (x->_right)
             {
                 return node_type::tree_minimum(x->_right);
             }
-            // backup _TNULL
-            node_ptr _TNULL = x->_right;
-            // Case 2: up until it came from left
-            while (x->_parent)
+            // Case 2: up until it came from left (the root's parent is the header)
+            node_ptr y = x->parent();
+            while (x == y->_right)
             {
-                if (x->_parent->_left == x)
-                {
-                    return x->_parent;
-                }
-                x = x->_parent;
+                x = y;
+                y = y->parent();
             }
-            // Case 3: return TNULL
-            return _TNULL;
+            // y is the successor, unless the root is the rightmost node :
+            // the climb then overshoots to the root and x already is the header
+            if (x->_right != y)
+                x = y;
+            return x;
         }
 
         _Self &operator++()
@@ -275,26 +296,23 @@ namespace ft
         node_ptr decrement(node_ptr _node)
         {
             // case header
-            if (node_type::isTNULL(_node))
+            if (_node->is_header())
             {
-                // node_type::tree_maximum(_node->_parent);
-                return node_type::tree_maximum(_node->_parent);
+                // end() keeps the rightmost node in _right
+                return _node->_right;
             }
             // 왼쪽 자식이 존재 할땐 부모의 오른쪽 자식 리턴하면 이함수에서 찾는 값이 충족 된다.
-            if (!node_type::isTNULL(_node->_left))
+            if (_node->_left)
             {
-                // node_type::tree_maximum(_node->_left);
                 return node_type::tree_maximum(_node->_left);
             }
-            while (_node->_parent)
+            node_ptr y = _node->parent();
+            while (_node == y->_left) // 내가 왼쪽 자식일때는 부모로 올라가는거.
             {
-                if (_node->_parent->_right == _node) // ㄴㅐ가 오른쪽 자식일때는 부모로 올로가는거. 
-                {
-                    return _node->_parent;
-                }
-                _node = _node->_parent;
+                _node = y;
+                y = _node->parent();
             }
-            return NULL;
+            return y;
         }
 
         _Self &operator--()
@@ -308,43 +326,67 @@ namespace ft
             --(*this);
             return temp;
         }
+        // see rbtree_iterator
+        _Self &operator+=(difference_type n)
+        {
+            _node = node_type::advance(_node, n);
+            return *this;
+        }
+        _Self &operator-=(difference_type n)
+        {
+            _node = node_type::advance(_node, -n);
+            return *this;
+        }
+        _Self operator+(difference_type n) const
+        {
+            return _Self(node_type::advance(_node, n));
+        }
+        _Self operator-(difference_type n) const
+        {
+            return _Self(node_type::advance(_node, -n));
+        }
+        difference_type operator-(const _Self &x) const
+        {
+            return static_cast<difference_type>(node_type::rank(_node))
+                - static_cast<difference_type>(node_type::rank(x._node));
+        }
         node_ptr base() const
         {
             return _node;
         }
     };
-    template <typename Value>
-    bool operator==(const rbtree_const_iterator<Value>& lhs, const rbtree_const_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator==(const rbtree_const_iterator<Value, Augment>& lhs, const rbtree_const_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() == rhs.base());
     }
 
-    template <typename Value>
-    bool operator!=(const rbtree_const_iterator<Value>& lhs, const rbtree_const_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator!=(const rbtree_const_iterator<Value, Augment>& lhs, const rbtree_const_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() != rhs.base());
     }
 
-    template <typename Value>
-    bool operator==(const rbtree_iterator<Value>& lhs, const rbtree_const_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator==(const rbtree_iterator<Value, Augment>& lhs, const rbtree_const_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() == rhs.base());
     }
 
-    template <typename Value>
-    bool operator!=(const rbtree_iterator<Value>& lhs, const rbtree_const_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator!=(const rbtree_iterator<Value, Augment>& lhs, const rbtree_const_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() != rhs.base());
     }
 
-    template <typename Value>
-    bool operator==(const rbtree_const_iterator<Value>& lhs, const rbtree_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator==(const rbtree_const_iterator<Value, Augment>& lhs, const rbtree_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() == rhs.base());
     }
 
-    template <typename Value>
-    bool operator!=(const rbtree_const_iterator<Value>& lhs, const rbtree_iterator<Value>& rhs)
+    template <typename Value, typename Augment>
+    bool operator!=(const rbtree_const_iterator<Value, Augment>& lhs, const rbtree_iterator<Value, Augment>& rhs)
     {
         return (lhs.base() != rhs.base());
     }
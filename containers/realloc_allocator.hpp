@@ -0,0 +1,108 @@
+#ifndef REALLOC_ALLOCATOR_HPP
+#define REALLOC_ALLOCATOR_HPP
+
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdlib>   // std::malloc, std::realloc, std::free
+#include <new>       // std::bad_alloc, placement new
+
+namespace ft
+{
+    /**
+     * @brief Realloc allocator
+     * Standard allocator on malloc / free with one extension, reallocate() :
+     * the block grows in place when the memory after it is free, and glibc moves
+     * large (mmap'ed) blocks with mremap, remapping the pages instead of copying them.
+     * ft::vector uses it for trivially relocatable elements (see has_reallocate).
+     * Stateless, all instances compare equal.
+     * @tparam T value_type
+     */
+    template <typename T>
+    class realloc_allocator
+    {
+        public:
+            // Member types
+            typedef T                   value_type;
+            typedef T*                  pointer;
+            typedef const T*            const_pointer;
+            typedef T&                  reference;
+            typedef const T&            const_reference;
+            typedef std::size_t         size_type;
+            typedef std::ptrdiff_t      difference_type;
+
+            template <typename U>
+            struct rebind
+            {
+                typedef realloc_allocator<U> other;
+            };
+
+            // Constructor
+            realloc_allocator() {}
+            realloc_allocator(const realloc_allocator &) {}
+            template <typename U>
+            realloc_allocator(const realloc_allocator<U> &) {}
+            ~realloc_allocator() {}
+
+            pointer address(reference x) const
+            {
+                return &x;
+            }
+            const_pointer address(const_reference x) const
+            {
+                return &x;
+            }
+
+            pointer allocate(size_type n, const void *hint = 0)
+            {
+                (void)hint;
+                void *p = std::malloc(n ? n * sizeof(T) : 1);
+
+                if (!p)
+                    throw std::bad_alloc();
+                return static_cast<pointer>(p);
+            }
+            void deallocate(pointer p, size_type n)
+            {
+                (void)n;
+                std::free(p);
+            }
+                // block of n elements starting with the bytes of p's first old_n, p is gone.
+                // p may be NULL (old_n 0). On failure throws, p is left untouched
+            pointer reallocate(pointer p, size_type old_n, size_type n)
+            {
+                (void)old_n;
+                void *q = std::realloc(p, n ? n * sizeof(T) : 1);
+
+                if (!q)
+                    throw std::bad_alloc();
+                return static_cast<pointer>(q);
+            }
+
+            size_type max_size() const
+            {
+                return size_type(-1) / sizeof(T);
+            }
+
+            void construct(pointer p, const_reference val)
+            {
+                new(static_cast<void *>(p)) T(val);
+            }
+            void destroy(pointer p)
+            {
+                p->~T();
+            }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const realloc_allocator<T> &, const realloc_allocator<U> &)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const realloc_allocator<T> &, const realloc_allocator<U> &)
+    {
+        return false;
+    }
+}
+
+#endif
@@ -4,13 +4,10 @@
 
 namespace ft
 {
+// no ft::iterator base: random_access_iterator already has one of the same type,
+// two empty bases of one type cannot share an address and would double the size
 template <class Iterator> 
-class reverse_iterator: public ft::iterator<typename ft::iterator_traits<Iterator>::iterator_category,
-                                            typename ft::iterator_traits<Iterator>::value_type,
-                                            typename ft::iterator_traits<Iterator>::difference_type,
-                                            typename ft::iterator_traits<Iterator>::pointer,
-                                            typename ft::iterator_traits<Iterator>::reference>
-                                        
+class reverse_iterator
 {
     public:
         //Member_types
@@ -40,9 +37,6 @@ class reverse_iterator: public ft::iterator<typename ft::iterator_traits<Iterato
         template<class Iter>       // copy (3)
         reverse_iterator(const reverse_iterator<Iter>& rev_it)
         :current_state(rev_it.base()) {}
-    // 소멸자
-        virtual ~reverse_iterator() {}
-        
         // return base iterator
         iterator_type base() const
         {
@@ -57,9 +51,11 @@ class reverse_iterator: public ft::iterator<typename ft::iterator_traits<Iterato
         } 
 
         //pointer
+            // asks the iterator itself : its reference may be a proxy object (flat_map)
         pointer operator->() const
         {
-            return &(operator*());
+            iterator_type tmp = current_state;
+            return _to_pointer(--tmp);
         }
 
         reverse_iterator& operator++()
@@ -114,6 +110,18 @@ class reverse_iterator: public ft::iterator<typename ft::iterator_traits<Iterato
         {
             return *(*this + __n);
         }
+
+    private:
+        template <class It>
+        static pointer _to_pointer(const It &it)
+        {
+            return it.operator->();
+        }
+        template <class P>
+        static P *_to_pointer(P *p)
+        {
+            return p;
+        }
 };
 
 // Non-member function overloads
@@ -19,7 +19,7 @@ namespace ft
         {
             return _x;
         }
-        T &operator()(const T &_x) const
+        const T &operator()(const T &_x) const
         {
             return _x;
         }
@@ -27,7 +27,8 @@ namespace ft
 
     template < class T,                  // set::key_type/value_type           
     class Compare = std::less<T>,        // set::key_compare/value_compare           
-    class Alloc = std::allocator<T> >      // set::allocator_type  
+    class Alloc = std::allocator<T>,       // set::allocator_type  
+    class Augment = ft::plain_nodes >      // ft::order_statistics : find_by_order, ...
     class set
     {
         public:
@@ -50,7 +51,7 @@ namespace ft
             typedef typename allocator_type::const_pointer           const_pointer;
 
         protected:
-            typedef rbtree<key_type, value_type, _Single<value_type>, key_compare, allocator_type> tree_type;
+            typedef rbtree<key_type, value_type, _Single<value_type>, key_compare, allocator_type, Augment> tree_type;
             typedef typename tree_type::node_type node_type;
             typedef typename tree_type::node_ptr node_ptr;
         public:
@@ -68,10 +69,8 @@ namespace ft
         public:
             // Constructor
             explicit set( const key_compare &comp = key_compare(),const allocator_type &alloc = allocator_type())
-            {
-                (void)comp;
-                (void)alloc;
-            }
+            : _tree(comp, alloc)
+            {}
 
 				/**
 				 * @brief Range constructor
@@ -86,34 +85,22 @@ namespace ft
 				 */
             template<class InputIt>
             set( InputIt first, InputIt last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+            : _tree(comp, alloc)
 			{   
-                (void)comp;
-			    (void)alloc;
-			    for (InputIt it = first; it != last; ++it)
-			    {
-				    this->insert(*it);
-		    	}
+                _tree._insert_range_unique(first, last);
 			}
 				// Copy constructor
 			set(const set& x)
-            {
-                *this = x;
-            }
+            : _tree(x._tree)
+            {}
 				// Destructor
-			virtual ~set() 
-			{
-				while(!this->empty())
-					this->erase(this->begin());
-			}
+			~set() 
+			{}
 			// Operator=
 			set& operator=(const set& __x)
 			{
 				if (this != &__x)
-				{
-                    this->clear();
-                    for (const_iterator it = __x.begin(); it != __x.end(); ++it)
-                        this->insert(*it);
-                }
+                    _tree = __x._tree;
 				return *this;
 			}
 			// Member functions
@@ -178,27 +165,19 @@ namespace ft
                     //single element (1)	
             ft::pair<iterator,bool> insert(const value_type& val)
             {
-                node_ptr temp = _tree._find_key(val);
-                if (temp)
-                    return ft::make_pair(iterator(temp), false);
-                else
-                {
-                    temp = _tree._rb_insert(val);
-                    return ft::make_pair(iterator(temp), true);
-                }
+                ft::pair<node_ptr, bool> ret = _tree._insert_unique(val);
+                return ft::make_pair(iterator(ret.first), ret.second);
             }
                     // with hint (2)	
             iterator insert (iterator position, const value_type& val)
             {
-                (void)position;
-			    return this->insert(val).first;
+                return iterator(_tree._insert_hint_unique(const_cast<node_ptr>(position.base()), val));
             }
                     //range (3)	
             template <class InputIterator>
             void insert (typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first, InputIterator last)
             {
-                for (; first != last; first++)
-				    this->insert(*first);
+                _tree._insert_range_unique(first, last);
             }
                 // erase
                     // (1)	
@@ -220,14 +199,7 @@ namespace ft
                     // (3)	
             void erase (iterator first, iterator last)
             {
-                iterator it = first++;
-
-                while(it != last)
-                {
-                    this->_tree._rb_delete(const_cast<node_ptr>(it._node));
-                    it = first;
-                    first++;
-                }
+                _tree._erase_range(const_cast<node_ptr>(first.base()), const_cast<node_ptr>(last.base()));
             }
                 // swap
             void swap(set &x)
@@ -238,20 +210,28 @@ namespace ft
                 // clear
             void clear()
             {
-                while(!this->empty())
-                    this->erase(this->begin());
+                _tree.clear();
+            }
+                // split / merge : see map
+            void split(const key_type &k, set &x)
+            {
+                _tree._split_off(k, x._tree);
+            }
+            void merge(set &x)
+            {
+                _tree._merge_unique(x._tree);
             }
             
             // Observers
                 // key_comp
             key_compare key_comp() const
             {
-                return key_compare();
+                return _tree.key_comp();
             }
                 //value_comp
             value_compare value_comp() const
             {
-                return (key_compare());
+                return _tree.key_comp();
             }
             
             // Operation
@@ -272,58 +252,81 @@ namespace ft
             //     else
             //         return this->end();
             // }
-                // size
+                    // heterogeneous lookup : only when key_compare is transparent,
+                    // k is compared as is, no key_type is constructed
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            find (const K& k) const
+            {
+                node_ptr temp = _tree._find_key(k);
+                return temp ? iterator(temp) : this->end();
+            }
+                // count
             size_type count (const key_type& k) const
             {
-                size_type n = 0;
-                for (const_iterator it = this->begin(); it != this->end(); ++it)
-                {
-                    if (_tree._equal(k,*it))
-                        ++n;
-                }
-                return n;
+                // unique keys : count is either 0 or 1
+                return (_tree._find_key(k) ? 1 : 0);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            count (const K& k) const
+            {
+                return (_tree._find_key(k) ? 1 : 0);
             }
                     // std::less::operator() lhs < rhs 이면 true , 그렇지 않으면 false 입니다.
                 //lower_bound
             iterator lower_bound (const key_type& k) const
             {
-                iterator it = this->begin();
-                while(key_comp()(*it, k) && it != this->end())
-                    ++it;
-                return it;
+                return iterator(_tree._lower_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            lower_bound (const K& k) const
+            {
+                return iterator(_tree._lower_bound(k));
             }
-            // const_iterator lower_bound (const key_type& k) const
-            // {
-            //     const_iterator it = this->begin();
-            //     while(key_comp()(*it, k) && it != this->end())
-            //         ++it;
-            //     return it;
-            // }
                 // upper_bound
             iterator upper_bound (const key_type& k) const
             {
-               iterator it = this->begin();
-                while(!key_comp()(k, *it) && it != this->end())
-                    ++it;
-                return it;
+                return iterator(_tree._upper_bound(k));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+            upper_bound (const K& k) const
+            {
+                return iterator(_tree._upper_bound(k));
             }
-            // const_iterator upper_bound (const key_type& k) const
-            // {
-            //     const_iterator it = this->begin();
-            //     while(!key_comp()(k, *it) && it != this->end())
-            //         ++it;
-            //     return it;
-            // }
                 // equal_range
             ft::pair<iterator,iterator>equal_range (const key_type& k) const
             {
-                return ft::pair<iterator,iterator>(lower_bound(k),upper_bound(k));
-                // return ft::make_pair(lower_bound(k),upper_bound(k));
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<iterator,iterator>(iterator(range.first), iterator(range.second));
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, ft::pair<iterator,iterator> >::type
+            equal_range (const K& k) const
+            {
+                ft::pair<node_ptr, node_ptr> range = _tree._equal_range(k);
+                return ft::pair<iterator,iterator>(iterator(range.first), iterator(range.second));
+            }
+
+            // Order statistics (see map)
+                // find_by_order : k-th element in key order (0-based), end() if k >= size()
+            iterator find_by_order(size_type k) const
+            {
+                return iterator(_tree._find_by_order(k));
+            }
+                // order_of_key : number of keys less than k
+            size_type order_of_key(const key_type &k) const
+            {
+                return _tree._order_of_key(k);
+            }
+            template <typename K>
+            typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+            order_of_key(const K &k) const
+            {
+                return _tree._order_of_key(k);
             }
-            // ft::pair<const_iterator,const_iterator>equal_range (const key_type& k) const
-            // {
-            //     return ft::make_pair(lower_bound(k),upper_bound(k));
-            // }
 
             // Allocator
             allocator_type get_allocator() const
@@ -334,44 +337,44 @@ namespace ft
     };
     // Non-member functions
         // Relational operators
-    template <typename Key, typename Compare, typename Alloc>
-    inline bool operator==(const set<Key, Compare, Alloc> &lhs, const set<Key, Compare, Alloc> &rhs)
+    template <typename Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator==(const set<Key, Compare, Alloc, Augment> &lhs, const set<Key, Compare, Alloc, Augment> &rhs)
     { 
         return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); 
     }
 
-    template <typename Key, typename Compare, typename Alloc>
-    inline bool operator!=(const set<Key, Compare, Alloc> &lhs, const set<Key, Compare, Alloc> &rhs)
+    template <typename Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator!=(const set<Key, Compare, Alloc, Augment> &lhs, const set<Key, Compare, Alloc, Augment> &rhs)
     { 
         return !(lhs == rhs); 
     }
 
-    template <typename Key, typename Compare, typename Alloc>
-    inline bool operator<(const set<Key, Compare, Alloc> &lhs, const set<Key, Compare, Alloc> &rhs)
+    template <typename Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator<(const set<Key, Compare, Alloc, Augment> &lhs, const set<Key, Compare, Alloc, Augment> &rhs)
     { 
         return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); 
     }
 
-    template <typename Key, typename Compare, typename Alloc>
-    inline bool operator>(const set<Key, Compare, Alloc> &lhs, const set<Key, Compare, Alloc> &rhs)
+    template <typename Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator>(const set<Key, Compare, Alloc, Augment> &lhs, const set<Key, Compare, Alloc, Augment> &rhs)
     { 
         return rhs < lhs; 
     }
 
-    template <typename Key, typename Compare, typename Alloc>
-    inline bool operator<=(const set<Key, Compare, Alloc> &lhs, const set<Key, Compare, Alloc> &rhs)
+    template <typename Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator<=(const set<Key, Compare, Alloc, Augment> &lhs, const set<Key, Compare, Alloc, Augment> &rhs)
     { 
         return !(rhs < lhs); 
     }
 
-    template <typename _Key, typename Compare, typename Alloc>
-    inline bool operator>=(const set<_Key, Compare, Alloc> &lhs, const set<_Key, Compare, Alloc> &rhs)
+    template <typename _Key, typename Compare, typename Alloc, typename Augment>
+    inline bool operator>=(const set<_Key, Compare, Alloc, Augment> &lhs, const set<_Key, Compare, Alloc, Augment> &rhs)
     { 
         return !(lhs < rhs); 
     }
 
-    template <typename _Key, typename Compare, typename Alloc>
-    void swap(set<_Key, Compare, Alloc>& x, set<_Key, Compare, Alloc>& y)
+    template <typename _Key, typename Compare, typename Alloc, typename Augment>
+    void swap(set<_Key, Compare, Alloc, Augment>& x, set<_Key, Compare, Alloc, Augment>& y)
     { 
         x.swap(y); 
     }
@@ -21,7 +21,7 @@ namespace ft
             explicit stack (const container_type& ctnr = container_type())
             :_x(ctnr) {}
             // destructor
-            virtual ~stack() {}
+            ~stack() {}
 
             // Member function
             
@@ -3,6 +3,7 @@
 
 # include <cstdint>
 # include <cstddef>
+# include <string>
 namespace ft
 {
     // enable_if 
@@ -111,6 +112,132 @@ namespace ft
     {
         static const bool value = true;
     };
+
+    // integral_constant : compile time value, as a type (tag dispatch)
+    template <typename T, T v>
+    struct integral_constant
+    {
+        typedef T                       value_type;
+        typedef integral_constant<T, v> type;
+        static const T value = v;
+    };
+
+    typedef integral_constant<bool, true>   true_type;
+    typedef integral_constant<bool, false>  false_type;
+
+    // is_floating_point
+    template <typename T>
+    struct is_floating_point
+    {
+        static const bool value = false;
+    };
+
+    template <>
+    struct is_floating_point<float>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct is_floating_point<double>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct is_floating_point<long double>
+    {
+        static const bool value = true;
+    };
+
+    // is_trivially_copyable
+        // true if a T is copied by copying its bytes : containers may then use memcpy / memmove
+        // and skip the allocator's construct / destroy.
+        // Detected for arithmetic types and pointers (and const ones),
+        // other PODs opt in with a specialization :
+        //     namespace ft { template <> struct is_trivially_copyable<Buffer> { static const bool value = true; }; }
+    template <typename T>
+    struct is_trivially_copyable
+    {
+        static const bool value = is_integral<T>::value || is_floating_point<T>::value;
+    };
+
+    template <typename T>
+    struct is_trivially_copyable<T *>
+    {
+        static const bool value = true;
+    };
+
+    template <typename T>
+    struct is_trivially_copyable<const T>
+    {
+        static const bool value = is_trivially_copyable<T>::value;
+    };
+
+    // is_trivially_relocatable
+        // true if moving a T to another address, then forgetting the old bytes without running
+        // the destructor, is a plain copy of its bytes : vector then reallocates with one memcpy
+        // instead of a copy construction + destruction (an allocation + a free for a string) per element.
+        // Trivially copyable types are, and so are most types owning memory through a pointer,
+        // as long as nothing points back into the object itself. Those opt in :
+        //     namespace ft { template <> struct is_trivially_relocatable<Handle> { static const bool value = true; }; }
+    template <typename T>
+    struct is_trivially_relocatable
+    {
+        static const bool value = is_trivially_copyable<T>::value;
+    };
+
+#if defined(__GLIBCXX__) && !_GLIBCXX_USE_CXX11_ABI
+        // the copy-on-write std::string of the old libstdc++ ABI is a single pointer.
+        // (the C++11 ABI string keeps a pointer to its own short-string buffer : not relocatable)
+    template <typename C, typename Tr, typename A>
+    struct is_trivially_relocatable<std::basic_string<C, Tr, A> >
+    {
+        static const bool value = true;
+    };
+#endif
+
+        // has_reallocate
+        // true if Alloc provides pointer reallocate(pointer p, size_type old_n, size_type n),
+        // which may grow p's block in place (see realloc_allocator)
+    template <typename Alloc>
+    struct has_reallocate
+    {
+        private:
+            typedef char yes[1];
+            typedef char no[2];
+
+            template <typename U, typename U::pointer (U::*)(typename U::pointer, typename U::size_type, typename U::size_type)>
+            struct _signature {};
+
+            template <typename U>
+            static yes &_test(_signature<U, &U::reallocate> *);
+            template <typename U>
+            static no &_test(...);
+
+        public:
+            static const bool value = (sizeof(_test<Alloc>(0)) == sizeof(yes));
+    };
+
+    // is_transparent
+        // true if Compare declares is_transparent : it compares key_type with other types,
+        // so lookups need not build a key_type (heterogeneous lookup)
+        // K is not used, it only makes the test depend on the parameter of a member template
+    template <typename Compare, typename K = void>
+    struct is_transparent
+    {
+        private:
+            typedef char yes[1];
+            typedef char no[2];
+
+            template <typename U>
+            static yes &_test(typename U::is_transparent *);
+            template <typename U>
+            static no &_test(...);
+
+        public:
+            static const bool value = (sizeof(_test<Compare>(0)) == sizeof(yes));
+    };
 }
 
 #endif
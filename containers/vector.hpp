@@ -8,6 +8,7 @@
 #include "iterator_base.hpp"
 
 #include <cstddef>   // std::ptrdiff_t
+#include <cstring>   // std::memcpy, std::memmove
 #include <memory>    // std::allocator
 #include <stdexcept> // std::out_of_range
 
@@ -16,6 +17,20 @@
 
 namespace ft
 {
+    /**
+     * @brief vector_growth
+     * Growth factor of ft::vector when push_back / insert / resize run out of capacity :
+     * the new capacity is max(needed, capacity * num / den), 2 by default.
+     * Specialize it for a value type to trade reallocations for memory (3 / 2 ...).
+     * reserve(n) is not affected, it allocates exactly n.
+     */
+    template <typename T>
+    struct vector_growth
+    {
+        static const std::size_t num = 2;
+        static const std::size_t den = 1;
+    };
+
     template < class T, class Alloc = std::allocator<T> >  // generic template  
     class vector
     {
@@ -48,6 +63,14 @@ namespace ft
             typedef typename ft::reverse_iterator<const_iterator> const_reverse_iterator;
             typedef std::ptrdiff_t  difference_type;
             typedef std::size_t    size_type;
+        private:
+            // elements are moved with memcpy / memmove (see is_trivially_copyable)
+            typedef ft::integral_constant<bool, ft::is_trivially_copyable<value_type>::value> _trivial;
+            // reallocation, insert and erase move the elements with one memcpy / memmove (see is_trivially_relocatable)
+            typedef ft::integral_constant<bool, ft::is_trivially_relocatable<value_type>::value> _relocatable;
+            // ... or in place when the allocator can (see has_reallocate)
+            typedef ft::integral_constant<bool, _relocatable::value && ft::has_reallocate<allocator_type>::value> _in_place;
+        public:
 
         //Member variables
         protected:
@@ -101,15 +124,12 @@ namespace ft
             {
                 // size_type n = x.size();
                 this->_start = this->_alloc.allocate(_capacity);
-                for (size_type i = 0; i < _size; ++i)
-                {
-                    _alloc.construct(_start + i, x[i]);
-                }
+                _copy_construct(_start, x._start, _size, _trivial());
                 // _end = _start  + n;
             }
 
             //destructor
-            virtual ~vector()
+            ~vector()
             {
                 this->clear();
                 // this->_alloc.deallocate(this->_start, size_type(this->_end_capacity - this->_start));
@@ -132,9 +152,8 @@ namespace ft
                 this->_alloc.deallocate(this->_start, _capacity);
                 _capacity = x._capacity;
                 _start = _alloc.allocate(_capacity);
+                _copy_construct(_start, x._start, x._size, _trivial());
                 _size = x._size;
-                for (_size = 0; _size < x._size; ++_size)
-                    _alloc.construct(_start + _size, x[_size]);
                 return (*this);
             }
 
@@ -206,7 +225,8 @@ namespace ft
                 }
                 else
                 {
-                    this->reserve(n);
+                    if (n > _capacity)
+                        _reallocate(_grow_capacity(n));
                     for (size_type i = _size; i < n; ++i)
                         _alloc.construct(_start + i, val);
                 }
@@ -226,27 +246,13 @@ namespace ft
                 // return (_start == _end);
                 return (_size == 0);
             }
-                // reverse
+                // reserve : exactly n, growing geometrically is left to push_back / insert
             void reserve (size_type n)
             {
-                // if (n > max_size())
-                // {
-                //     throw std::length_error("ft_vector"); 
-                // }
+                if (n > max_size())
+                    throw std::length_error("ft::vector");
                 if (n > this->_capacity)
-                {
-                    pointer tmp = _start;
-                    if (n < _capacity * 2)
-                        n = _capacity * 2;
-                    _start = _alloc.allocate(n);
-                    for (size_type i = 0; i < _size; i++)
-                    {
-                        _alloc.construct(_start + i, tmp[i]);
-                        _alloc.destroy(tmp + i);
-                    }
-                    _alloc.deallocate(tmp, this->capacity());
-                    _capacity = n;
-                }
+                    _reallocate(n);
             }
 
             // Element access
@@ -342,13 +348,16 @@ namespace ft
             {
                 // 꽉 찼으면 resize(a+1);
                 // 아니면 construct 로 데이터 넣기
-                if (_size + 1 > _capacity)
-                    this->resize(_size + 1, val);
-                else
+                if (_size == _capacity)
                 {
-                    _alloc.construct(_start + _size, val);
-                    ++_size;
+                    // val may live in the current block, copy it before the reallocation
+                    value_type tmp(val);
+                    _reallocate(_grow_capacity(_size + 1));
+                    _alloc.construct(_start + _size, tmp);
                 }
+                else
+                    _alloc.construct(_start + _size, val);
+                ++_size;
             }
 
                 // pop_back
@@ -372,11 +381,12 @@ namespace ft
                 size_type i = position - this->begin();
                 if ( n == 0)
                     return ;
-				this->reserve(_size + n);
-				for (iterator it = this->end(); it != this->begin()+i; --it)
-					*(it -1 + n) = *(it-1);
-				for (size_type k = 0; k < n; ++k)
-					_alloc.construct(_start + i + k, val);
+				value_type tmp(val);
+				size_type live = _open_gap(i, n);
+				for (size_type k = 0; k < live; ++k)
+					_start[i + k] = tmp;
+				for (size_type k = live; k < n; ++k)
+					_alloc.construct(_start + i + k, tmp);
 				_size += n;
 				// _end += n;
             }
@@ -394,10 +404,10 @@ namespace ft
 					++n;
                 if ( n == 0)
                     return ;
-				this->reserve(_size + n);
-				for (iterator it = this->end(); it != this->begin()+i; --it)
-					*(it -1 + n) = *(it-1);
-				for (size_type k = 0; k < n; ++k)
+				size_type live = _open_gap(i, n);
+				for (size_type k = 0; k < live; ++k)
+					_start[i + k] = *first++;
+				for (size_type k = live; k < n; ++k)
 					_alloc.construct(_start + i + k, *first++);
 				_size += n;
 				// _end += n;
@@ -411,23 +421,7 @@ namespace ft
 
             iterator erase (iterator first, iterator last)
             {
-				size_type i = 0;
-				iterator temp;
-				temp = first;
-				
-				while(temp != last)
-				{
-					_alloc.destroy(&(*temp));
-					temp++;
-				}
-				
-				temp = last;
-				while(temp != this->end())
-				{
-					*(first + i) = *temp;
-					++i;
-					++temp;
-				}
+				_erase(first - begin(), last - begin(), _relocatable());
 				_size -= last - first;
 				// _end = _end - (last - first);
 				return first;
@@ -463,6 +457,140 @@ namespace ft
             {
                 return (_alloc);
             }
+
+        private:
+                // capacity for at least n elements on the push_back / insert / resize path
+            size_type _grow_capacity(size_type n) const
+            {
+                const size_type num = vector_growth<value_type>::num;
+                const size_type den = vector_growth<value_type>::den;
+                size_type max = max_size();
+
+                if (n > max)
+                    throw std::length_error("ft::vector");
+                if (_capacity > max / num * den)
+                    return max;
+                size_type cap = _capacity * num / den;
+                return (cap < n) ? n : cap;
+            }
+                // move the elements into a block of exactly n
+            void _reallocate(size_type n)
+            {
+                _reallocate(n, _in_place());
+            }
+                // the allocator resizes the block (realloc / mremap) : no second block, no copy
+                // when it grows in place, no 3x peak (old block + new block) when it does not
+            void _reallocate(size_type n, ft::true_type)
+            {
+                _start = _alloc.reallocate(_start, _capacity, n);
+                _capacity = n;
+            }
+            void _reallocate(size_type n, ft::false_type)
+            {
+                pointer tmp = _start;
+
+                _start = _alloc.allocate(n);
+                _relocate(_start, tmp, _size, _relocatable());
+                _alloc.deallocate(tmp, _capacity);
+                _capacity = n;
+            }
+
+            // element transfers : _trivial() / _relocatable() pick one bulk memcpy / memmove,
+            // or the allocator's construct / destroy one element at a time
+            // (the void * casts : an opted-in type may still declare its own copy)
+                // copy n elements from src into raw memory at dest
+            void _copy_construct(pointer dest, const_pointer src, size_type n, ft::true_type)
+            {
+                if (n != 0)
+                    std::memcpy(static_cast<void *>(dest), static_cast<const void *>(src), n * sizeof(value_type));
+            }
+            void _copy_construct(pointer dest, const_pointer src, size_type n, ft::false_type)
+            {
+                for (size_type i = 0; i < n; ++i)
+                    _alloc.construct(dest + i, src[i]);
+            }
+                // move n elements from src to raw memory at dest, src is left raw
+                // (relocatable types : the bytes move, the old copies are never destroyed)
+            void _relocate(pointer dest, pointer src, size_type n, ft::true_type)
+            {
+                _copy_construct(dest, src, n, ft::true_type());
+            }
+            void _relocate(pointer dest, pointer src, size_type n, ft::false_type)
+            {
+                for (size_type i = 0; i < n; i++)
+                {
+                    _alloc.construct(dest + i, src[i]);
+                    _alloc.destroy(src + i);
+                }
+            }
+                // open a gap of n slots at pos for insert, growing if needed :
+                // returns how many of them still hold live elements (to be assigned),
+                // the others are raw memory (to be constructed)
+            size_type _open_gap(size_type pos, size_type n)
+            {
+                if (_size + n > _capacity)
+                    return _reallocate_gap(_grow_capacity(_size + n), pos, n, _in_place());
+                return _open_gap(pos, n, _relocatable());
+            }
+                // the tail is relocated by n : the whole gap is raw
+            size_type _open_gap(size_type pos, size_type n, ft::true_type)
+            {
+                if (pos != _size)
+                    std::memmove(static_cast<void *>(_start + pos + n), static_cast<const void *>(_start + pos), (_size - pos) * sizeof(value_type));
+                return 0;
+            }
+                // the last n elements are copy constructed past end(), the rest of the tail
+                // is assigned backwards within the live range
+            size_type _open_gap(size_type pos, size_type n, ft::false_type)
+            {
+                size_type tail = _size - pos;
+
+                if (tail > n)
+                {
+                    for (size_type k = _size - n; k < _size; ++k)
+                        _alloc.construct(_start + k + n, _start[k]);
+                    for (size_type k = _size - n; k > pos; --k)
+                        _start[k - 1 + n] = _start[k - 1];
+                    return n;
+                }
+                for (size_type k = pos; k < _size; ++k)
+                    _alloc.construct(_start + k + n, _start[k]);
+                return tail;
+            }
+                // grow in place, then relocate the tail
+            size_type _reallocate_gap(size_type cap, size_type pos, size_type n, ft::true_type)
+            {
+                _reallocate(cap, ft::true_type());
+                return _open_gap(pos, n, ft::true_type());
+            }
+                // the new block is filled around the gap : every element moves once
+            size_type _reallocate_gap(size_type cap, size_type pos, size_type n, ft::false_type)
+            {
+                pointer tmp = _start;
+
+                _start = _alloc.allocate(cap);
+                _relocate(_start, tmp, pos, _relocatable());
+                _relocate(_start + pos + n, tmp + pos, _size - pos, _relocatable());
+                _alloc.deallocate(tmp, _capacity);
+                _capacity = cap;
+                return 0;
+            }
+                // destroy [first, last) and relocate the tail over it
+            void _erase(size_type first, size_type last, ft::true_type)
+            {
+                for (size_type i = first; i < last; ++i)
+                    _alloc.destroy(_start + i);
+                if (last != _size)
+                    std::memmove(static_cast<void *>(_start + first), static_cast<const void *>(_start + last), (_size - last) * sizeof(value_type));
+            }
+                // assign the tail down over [first, last), then destroy what is left past the new end
+            void _erase(size_type first, size_type last, ft::false_type)
+            {
+                for (size_type i = last; i < _size; ++i)
+                    _start[first + (i - last)] = _start[i];
+                for (size_type i = _size - (last - first); i < _size; ++i)
+                    _alloc.destroy(_start + i);
+            }
 		};
         /*
         * Non-Member overloads :
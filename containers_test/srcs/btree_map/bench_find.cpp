@@ -0,0 +1,31 @@
+#include "common.hpp"
+
+// Benchmark: find on 2 * 10^6 keys, scattered queries with half of them missing.
+// Reference side is the rbtree based ft::map (see common.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 2000000
+#define N_QUERIES 4000000
+
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::btree_map<T1, T2> ft_map;
+
+int		main(void)
+{
+	ft_map mp;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(mp.end(), T3(i * 2, i % 13));
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		T1 key = (int)(((long)i * 7919) % (2L * N_KEYS));
+		ft_map::const_iterator it = mp.find(key);
+		if (it != mp.end())
+			sum += it->second + 1;
+	}
+	std::cout << "find checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,33 @@
+#include "common.hpp"
+
+// Benchmark: 10^6 scattered inserts, 10^6 appends after the maximum, then erasing every other key.
+// Reference side is the rbtree based ft::map (see common.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::btree_map<T1, T2> ft_map;
+
+int		main(void)
+{
+	ft_map mp;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(T3((int)(((long)i * 7919) % N_KEYS), i));
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(mp.end(), T3(N_KEYS + i, i));
+	std::cout << "size: " << mp.size() << std::endl;
+
+	for (int i = 0; i < 2 * N_KEYS; i += 2)
+		sum += mp.erase((int)(((long)i * 7919) % (2 * N_KEYS)));
+	std::cout << "erased: " << sum << " size: " << mp.size() << std::endl;
+
+	for (ft_map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->first ^ it->second;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "common.hpp"
+#include <cstdlib>
+
+// Benchmark: bytes requested from operator new per entry, 10^6 scattered inserts.
+// Reference side is the rbtree based ft::map (see common.hpp) : one 32 byte node per entry.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+
+static std::size_t g_new_bytes = 0;
+
+void	*operator new(std::size_t size)
+{
+	g_new_bytes += size;
+	void *p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void	operator delete(void *p) throw()
+{
+	std::free(p);
+}
+
+int		main(void)
+{
+	long sum = 0;
+	std::size_t bytes;
+
+	{
+		TESTED_NAMESPACE::btree_map<T1, T2> mp;
+		g_new_bytes = 0;
+		for (int i = 0; i < N_KEYS; ++i)
+			mp.insert(_pair<const T1, T2>((int)(((long)i * 7919) % N_KEYS), i));
+		bytes = g_new_bytes;
+		sum += mp.size();
+	}
+	std::cout << "checksum: " << sum << std::endl;
+	// a map node is the value and 3 pointers (no subtree size by default)
+	std::cout << "at most one map node per entry: " << (bytes <= N_KEYS * sizeof(ft::rbtree_node<_pair<const T1, T2>, ft::plain_nodes>)) << std::endl;
+	return (0);
+}
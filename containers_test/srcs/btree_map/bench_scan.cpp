@@ -0,0 +1,37 @@
+#include "common.hpp"
+
+// Benchmark: range scans, lower_bound then a walk over the next 256 entries, 10^6 keys.
+// Reference side is the rbtree based ft::map (see common.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+#define N_SCANS 50000
+#define SCAN_LEN 256
+
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::btree_map<T1, T2> ft_map;
+
+int		main(void)
+{
+	ft_map mp;
+	long sum = 0;
+
+	// scattered inserts : nodes are not laid out in key order
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(T3((int)(((long)i * 7919) % N_KEYS), i & 0xff));
+	for (int i = 0; i < N_SCANS; ++i)
+	{
+		ft_map::const_iterator it = mp.lower_bound((int)(((long)i * 104729) % N_KEYS));
+		for (int n = 0; n < SCAN_LEN && it != mp.end(); ++n, ++it)
+			sum += it->second;
+	}
+	std::cout << "scan checksum: " << sum << std::endl;
+
+	sum = 0;
+	for (ft_map::const_reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+		sum += it->first - it->second;
+	std::cout << "reverse checksum: " << sum << std::endl;
+	return (0);
+}
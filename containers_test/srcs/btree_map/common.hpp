@@ -0,0 +1,51 @@
+#include "../base.hpp"
+#include "btree_map.hpp"
+
+// There is no std::btree_map : the reference output comes from ft::map,
+// the rbtree based container btree_map has to agree with.
+#if defined(USING_STD)
+# include "map.hpp"
+# undef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+# define btree_map map
+#endif /* defined(USING_STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	std::cout << "max_size: " << mp.max_size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+		{
+			std::cout << "- " << printPair(it, false) << std::endl;
+		}
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+template <typename T1, typename T2>
+void	printReverse(TESTED_NAMESPACE::btree_map<T1, T2> &mp)
+{
+	typename TESTED_NAMESPACE::btree_map<T1, T2>::reverse_iterator it = mp.rbegin(), ite = mp.rend();
+
+	std::cout << "printReverse:" << std::endl;
+	for (; it != ite; ++it)
+		std::cout << "-> " << printPair(it, false) << std::endl;
+	std::cout << "_______________________________________________" << std::endl;
+}
@@ -0,0 +1,67 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// a mapped_type whose copy throws once the budget runs out :
+// a failed copy must free what it built, a failed assignment leaves the map empty
+static int g_budget = -1;
+
+struct Value
+{
+	int v;
+
+	Value(int x = 0) : v(x) {}
+	Value(const Value &x) : v(x.v)
+	{
+		if (g_budget >= 0 && g_budget-- == 0)
+			throw std::runtime_error("copy budget");
+	}
+	Value &operator=(const Value &x)
+	{
+		v = x.v;
+		return *this;
+	}
+};
+
+typedef TESTED_NAMESPACE::btree_map<int, Value> _map;
+
+int		main(void)
+{
+	_map	mp;
+
+	for (int i = 0; i < 100; ++i)
+		mp[i] = Value(i);
+
+	for (int budget = 0; budget < 100; budget += 33)
+	{
+		g_budget = budget;
+		try
+		{
+			_map copy(mp);
+			std::cout << "copy: " << copy.size() << std::endl;
+		}
+		catch (const std::exception &e)
+		{
+			std::cout << "copy: " << e.what() << std::endl;
+		}
+
+		_map dst;
+		g_budget = -1;
+		dst[-1] = Value(-1);
+		g_budget = budget;
+		try
+		{
+			dst = mp;
+			std::cout << "assign: " << dst.size() << std::endl;
+		}
+		catch (const std::exception &e)
+		{
+			std::cout << "assign: " << e.what() << " size: " << dst.size()
+				<< " empty: " << (dst.begin() == dst.end()) << std::endl;
+		}
+		g_budget = -1;
+		dst[7] = Value(7);
+		std::cout << "reuse: " << dst.size() << " " << dst.begin()->first << std::endl;
+	}
+	std::cout << "source: " << mp.size() << " " << mp[42].v << std::endl;
+	return (0);
+}
@@ -0,0 +1,39 @@
+#include "common.hpp"
+
+// operator[] : a hit returns the stored value untouched,
+// a miss default-constructs exactly one mapped_type, also when a leaf / the root splits.
+
+static int g_defaults = 0;
+
+struct Value
+{
+	int v;
+
+	Value() : v(-1) { ++g_defaults; }
+	Value(int x) : v(x) {}
+};
+
+typedef TESTED_NAMESPACE::btree_map<int, Value> _map;
+
+int		main(void)
+{
+	_map	mp;
+
+	// scattered misses : splits on every level
+	for (int i = 0; i < 2000; ++i)
+		mp[(i * 7919) % 2000].v = i;
+	std::cout << "size: " << mp.size() << " defaults: " << g_defaults << std::endl;
+
+	g_defaults = 0;
+	long sum = 0;
+	for (int i = 0; i < 2000; i += 3)
+		sum += mp[i].v;
+	std::cout << "hits sum: " << sum << " defaults: " << g_defaults << std::endl;
+
+	g_defaults = 0;
+	for (int i = -5; i < 0; ++i)
+		std::cout << "[" << i << "] " << mp[i].v << std::endl;
+	std::cout << "size: " << mp.size() << " defaults: " << g_defaults << std::endl;
+	std::cout << "first: " << mp.begin()->first << " last: " << (--mp.end())->first << std::endl;
+	return (0);
+}
@@ -0,0 +1,37 @@
+#include "../base.hpp"
+#include "btree_set.hpp"
+
+// There is no std::btree_set : the reference output comes from ft::set,
+// the rbtree based container btree_set has to agree with.
+#if defined(USING_STD)
+# include "set.hpp"
+# undef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+# define btree_set set
+#endif /* defined(USING_STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	std::cout << "max_size: " << st.max_size() << std::endl;
+	if (print_content)
+	{
+		typename T_SET::const_iterator it = st.begin(), ite = st.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+#include <vector>
+
+// Benchmark: find / lower_bound on 10^3 .. 10^7 keys, built from a sorted range.
+// Reference side is the node based ft::map (see common.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_QUERIES 2000000
+
+typedef _pair<T1, T2> T3;
+typedef TESTED_NAMESPACE::flat_map<T1, T2> ft_map;
+
+int		main(void)
+{
+	long sum = 0;
+
+	for (int n = 1000; n <= 10000000; n *= 10)
+	{
+		std::vector<T3> sorted;
+		sorted.reserve(n);
+		for (int i = 0; i < n; ++i)
+			sorted.push_back(T3(i * 2, i % 7));
+		ft_map mp(sorted.begin(), sorted.end());
+
+		long found = 0;
+		for (int i = 0; i < N_QUERIES; ++i)
+		{
+			// scattered keys, half of them missing
+			T1 key = (int)(((long)i * 7919) % ((long)n * 2));
+			ft_map::const_iterator it = mp.find(key);
+			if (it != mp.end())
+				found += it->second;
+			ft_map::const_iterator lo = mp.lower_bound(key + 1);
+			if (lo != mp.end())
+				sum += lo->first & 0xff;
+		}
+		std::cout << "n: " << n << " size: " << mp.size() << " found: " << found << std::endl;
+		sum += found;
+	}
+	std::cout << "lookup checksum: " << sum << std::endl;
+	return (0);
+}
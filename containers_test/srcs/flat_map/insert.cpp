@@ -0,0 +1,60 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+#define T2 int
+typedef TESTED_NAMESPACE::flat_map<T1, T2> ft_map;
+typedef ft_map::value_type T3;
+typedef ft_map::iterator ft_iterator;
+
+static int iter = 0;
+
+void	printRet(const _pair<ft_iterator, bool> &ret)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "insert return: " << printPair(ret.first, false) << " | created: " << ret.second << std::endl;
+}
+
+int		main(void)
+{
+	std::list<T3> lst;
+	// unsorted, with equivalent keys : the first one wins
+	int keys[] = {42, 7, 19, 7, -3, 100, 19, 0, 55, 42};
+	for (int i = 0; i < 10; ++i)
+		lst.push_back(T3(keys[i], i + 1));
+
+	ft_map mp(lst.begin(), lst.end());
+	printSize(mp);
+
+	printRet(mp.insert(T3(8, 8)));
+	printRet(mp.insert(T3(42, -1)));
+	printRet(mp.insert(T3(-10, -10)));
+	printRet(mp.insert(T3(1000, 1000)));
+
+	// good and bad hints
+	mp.insert(mp.find(19), T3(18, 180));
+	mp.insert(mp.begin(), T3(60, 600));
+	mp.insert(mp.end(), T3(2000, 2000));
+	printSize(mp);
+
+	mp[5] = 50;
+	mp[7] = 70;
+	std::cout << "op[] read: [" << mp[99] << "]" << std::endl;
+	printSize(mp);
+
+	// range insert into a filled map
+	ft_map mp2;
+	mp2[1] = 1; mp2[42] = 4242; mp2[3000] = 3000;
+	mp.insert(mp2.begin(), mp2.end());
+	printSize(mp);
+
+	std::cout << "erase(key): " << mp.erase(0) << " " << mp.erase(12345) << std::endl;
+	mp.erase(mp.begin());
+	mp.erase(mp.find(19), mp.find(60));
+	printSize(mp);
+	printReverse(mp);
+
+	mp.clear();
+	printSize(mp);
+	return (0);
+}
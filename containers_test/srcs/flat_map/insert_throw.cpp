@@ -0,0 +1,61 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// a mapped_type whose copy throws : the failed insert must leave the map unchanged
+struct Value
+{
+	int v;
+
+	Value(int x = 0) : v(x) {}
+	Value(const Value &x) : v(x.v)
+	{
+		if (x.v < 0)
+			throw std::runtime_error("poisoned value");
+	}
+	Value &operator=(const Value &x)
+	{
+		v = x.v;
+		return *this;
+	}
+};
+
+std::ostream	&operator<<(std::ostream &o, const Value &x)
+{
+	return o << x.v;
+}
+
+typedef TESTED_NAMESPACE::flat_map<int, Value> _map;
+
+static void	try_insert(_map &mp, const _pair<const int, Value> &val)
+{
+	try
+	{
+		mp.insert(val);
+		std::cout << "inserted " << val.first << std::endl;
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << "insert " << val.first << ": " << e.what() << std::endl;
+	}
+}
+
+int		main(void)
+{
+	_map	mp;
+
+	for (int i = 0; i < 6; ++i)
+		mp[i * 10] = Value(i);
+
+	try_insert(mp, _pair<const int, Value>(15, Value(7)));
+	// the pair is built from an int, only its copy into the map throws
+	_pair<const int, Value> bad(25, Value());
+	bad.second.v = -1;
+	try_insert(mp, bad);
+	try_insert(mp, _pair<const int, Value>(35, Value(8)));
+	printSize(mp);
+
+	// keys and values still line up
+	for (int k = 0; k <= 50; k += 5)
+		std::cout << k << ": " << mp.count(k) << " " << (mp.count(k) ? mp[k].v : -1) << std::endl;
+	return (0);
+}
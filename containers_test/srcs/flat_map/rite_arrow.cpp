@@ -0,0 +1,48 @@
+#include "common.hpp"
+
+#define T1 float
+#define T2 foo<int>
+typedef _pair<const T1, T2> T3;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::flat_map<T1, T2> mp;
+
+	// ascending keys : every insert lands at end()
+	for (int i = 4; i >= 0; --i)
+		mp.insert(T3(2.5 - i, (i + 1) * 7));
+
+	TESTED_NAMESPACE::flat_map<T1, T2>::reverse_iterator it(mp.rbegin());
+	TESTED_NAMESPACE::flat_map<T1, T2>::const_reverse_iterator ite(mp.rbegin());
+	printSize(mp);
+
+	printPair(++ite);
+	printPair(ite++);
+	printPair(ite++);
+	printPair(++ite);
+
+	it->second.m();
+	ite->second.m();
+
+	printPair(++it);
+	printPair(it++);
+	printPair(it++);
+	printPair(++it);
+
+	printPair(--ite);
+	printPair(ite--);
+	printPair(--ite);
+	printPair(ite--);
+
+	(*it).second.m();
+	(*ite).second.m();
+
+	printPair(--it);
+	printPair(it--);
+	printPair(it--);
+	printPair(--it);
+
+	it->second = 84;
+	printSize(mp);
+	return (0);
+}
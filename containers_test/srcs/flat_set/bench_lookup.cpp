@@ -0,0 +1,40 @@
+#include "common.hpp"
+#include <vector>
+
+// Benchmark: find / lower_bound on 10^3 .. 10^7 keys, built from a sorted range.
+// Reference side is the node based ft::set (see common.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define N_QUERIES 2000000
+
+typedef TESTED_NAMESPACE::flat_set<T1> ft_set;
+
+int		main(void)
+{
+	long sum = 0;
+
+	for (int n = 1000; n <= 10000000; n *= 10)
+	{
+		std::vector<T1> sorted;
+		sorted.reserve(n);
+		for (int i = 0; i < n; ++i)
+			sorted.push_back(i * 2);
+		ft_set st(sorted.begin(), sorted.end());
+
+		long found = 0;
+		for (int i = 0; i < N_QUERIES; ++i)
+		{
+			// scattered keys, half of them missing
+			T1 key = (int)(((long)i * 7919) % ((long)n * 2));
+			found += (st.find(key) != st.end());
+			ft_set::const_iterator lo = st.lower_bound(key + 1);
+			if (lo != st.end())
+				sum += *lo & 0xff;
+		}
+		std::cout << "n: " << n << " size: " << st.size() << " found: " << found << std::endl;
+		sum += found;
+	}
+	std::cout << "lookup checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,48 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+typedef TESTED_NAMESPACE::flat_set<T1> ft_set;
+typedef ft_set::iterator ft_iterator;
+
+static int iter = 0;
+
+void	printRet(const _pair<ft_iterator, bool> &ret)
+{
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "insert return: " << printPair(ret.first, false) << " | created: " << ret.second << std::endl;
+}
+
+int		main(void)
+{
+	std::list<T1> lst;
+	int keys[] = {42, 7, 19, 7, -3, 100, 19, 0};
+	for (int i = 0; i < 8; ++i)
+		lst.push_back(keys[i]);
+
+	ft_set st(lst.begin(), lst.end());
+	printSize(st);
+
+	printRet(st.insert(8));
+	printRet(st.insert(100));
+	printRet(st.insert(1000));
+	st.insert(st.find(42), 41);
+	st.insert(st.begin(), 55);
+	printSize(st);
+
+	ft_set st2;
+	st2.insert(-50); st2.insert(7); st2.insert(500);
+	st.insert(st2.begin(), st2.end());
+	printSize(st);
+
+	std::cout << "erase(key): " << st.erase(100) << " " << st.erase(12345) << std::endl;
+	st.erase(st.begin());
+	st.erase(st.find(0), st.find(42));
+	printSize(st);
+
+	ft_set::reverse_iterator it = st.rbegin(), ite = st.rend();
+	for (; it != ite; ++it)
+		std::cout << "-> " << *it << std::endl;
+	std::cout << "compare: " << (st == st2) << " " << (st2 < st) << " " << (st < st2) << std::endl;
+	return (0);
+}
@@ -0,0 +1,73 @@
+#include "common.hpp"
+#include "pool_allocator.hpp"
+#include <cstdlib>
+
+// Benchmark: insert/erase heavy workload, counting calls to operator new
+// with the default allocator and with ft::pool_allocator (used by both namespaces).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 200000
+#define N_ROUNDS 5
+
+static std::size_t g_new_calls = 0;
+
+void	*operator new(std::size_t size)
+{
+	++g_new_calls;
+	void *p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void	operator delete(void *p) throw()
+{
+	std::free(p);
+}
+
+template <typename MAP>
+long	workload(MAP &mp)
+{
+	long sum = 0;
+
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		for (int i = 0; i < N_KEYS; ++i)
+			mp.insert(_pair<const T1, T2>((int)(((long)i * 7919) % N_KEYS), i));
+		for (int i = 0; i < N_KEYS; i += 2)
+			mp.erase(i);
+		sum += mp.size();
+	}
+	mp.clear();
+	return sum;
+}
+
+int		main(void)
+{
+	typedef TESTED_NAMESPACE::map<T1, T2> plain_map;
+	typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, ft::pool_allocator<_pair<const T1, T2> > > pool_map;
+	std::size_t plain_calls, pool_calls;
+	long sum = 0;
+
+	{
+		plain_map mp;
+		g_new_calls = 0;
+		sum += workload(mp);
+		plain_calls = g_new_calls;
+	}
+	{
+		pool_map mp;
+		g_new_calls = 0;
+		sum += workload(mp);
+		pool_calls = g_new_calls;
+		std::cout << "allocator equal: " << (mp.get_allocator() == pool_map::allocator_type()) << std::endl;
+	}
+	std::cout << "checksum: " << sum << std::endl;
+	// default allocator : at least one operator new per node
+	std::cout << "plain >= one per node: " << (plain_calls >= (std::size_t)N_KEYS) << std::endl;
+	// pool : nodes come from chunks
+	std::cout << "pool < 1% of plain: " << (pool_calls * 100 < plain_calls) << std::endl;
+	return (0);
+}
@@ -0,0 +1,48 @@
+#include "common.hpp"
+
+// Benchmark: 10^6 keys, range queries must descend the tree (O(log n)).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+#define N_QUERIES 100000
+
+typedef TESTED_NAMESPACE::map<T1, T2>::iterator ft_iterator;
+typedef TESTED_NAMESPACE::map<T1, T2>::const_iterator ft_const_iterator;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	long sum = 0;
+
+	// even keys only, so half the queries fall between two keys
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(_pair<const T1, T2>(i * 2, i));
+	std::cout << "size: " << mp.size() << std::endl;
+
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		T1 key = (int)(((long)i * 7919) % (N_KEYS * 2 + 2)) - 1;
+		ft_iterator lo = mp.lower_bound(key);
+		ft_iterator up = mp.upper_bound(key);
+
+		sum += (lo == mp.end()) ? -1 : lo->second;
+		sum += (up == mp.end()) ? -1 : up->second;
+	}
+	std::cout << "bounds checksum: " << sum << std::endl;
+
+	sum = 0;
+	const TESTED_NAMESPACE::map<T1, T2> &c_mp = mp;
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		T1 key = (int)(((long)i * 104729) % (N_KEYS * 2 + 2)) - 1;
+		_pair<ft_const_iterator, ft_const_iterator> range = c_mp.equal_range(key);
+
+		sum += (range.first == c_mp.end()) ? -1 : range.first->second;
+		sum += (range.second == c_mp.end()) ? -1 : range.second->second;
+		sum += (range.first != range.second);
+	}
+	std::cout << "equal_range checksum: " << sum << std::endl;
+	return (0);
+}
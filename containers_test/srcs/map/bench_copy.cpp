@@ -0,0 +1,35 @@
+#include "common.hpp"
+
+// Benchmark: snapshots of a 10^6 entries map (copy constructor and operator=).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+#define N_COPIES 3
+
+typedef TESTED_NAMESPACE::map<T1, T2>::const_iterator ft_const_iterator;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(mp.end(), _pair<const T1, T2>(i, i % 97));
+
+	TESTED_NAMESPACE::map<T1, T2> snapshot;
+	for (int i = 0; i < N_COPIES; ++i)
+	{
+		TESTED_NAMESPACE::map<T1, T2> copy(mp);
+
+		mp[i] = -i;
+		snapshot = mp;
+		sum += copy.size() + snapshot.size() + copy.begin()->second + snapshot.begin()->second;
+	}
+	std::cout << "equal: " << (snapshot == mp) << std::endl;
+	for (ft_const_iterator it = snapshot.begin(); it != snapshot.end(); ++it)
+		sum += it->second;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
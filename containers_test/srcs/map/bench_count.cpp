@@ -0,0 +1,27 @@
+#include "common.hpp"
+
+// Benchmark: membership tests with count(), one descent per call (O(log n)).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#ifndef N_KEYS
+# define N_KEYS 100000
+#endif
+#define N_QUERIES 1000000
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	long hits = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(_pair<const T1, T2>(i * 3, i));
+	std::cout << "size: " << mp.size() << std::endl;
+
+	const TESTED_NAMESPACE::map<T1, T2> &c_mp = mp;
+	for (int i = 0; i < N_QUERIES; ++i)
+		hits += c_mp.count((int)(((long)i * 7919) % (N_KEYS * 3)));
+	std::cout << "count hits: " << hits << std::endl;
+	return (0);
+}
@@ -0,0 +1,49 @@
+#include "common.hpp"
+
+// Benchmark: expiring large windows with erase(first, last), then erase(begin(), end()).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+
+typedef TESTED_NAMESPACE::map<T1, T2>::iterator ft_iterator;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(mp.end(), _pair<const T1, T2>(i, i % 7));
+
+	// oldest half
+	mp.erase(mp.begin(), mp.lower_bound(N_KEYS / 2));
+	std::cout << "size: " << mp.size() << " begin: " << mp.begin()->first << std::endl;
+	// a window in the middle
+	mp.erase(mp.lower_bound(N_KEYS / 2 + 1000), mp.lower_bound(N_KEYS / 2 + 200000));
+	std::cout << "size: " << mp.size() << std::endl;
+	// short windows
+	for (int i = 0; i < 1000; ++i)
+	{
+		ft_iterator it = mp.lower_bound(N_KEYS / 2 + 200000 + i * 100);
+		ft_iterator ite = it;
+		for (int j = 0; j < i % 40; ++j)
+			++ite;
+		mp.erase(it, ite);
+	}
+	std::cout << "size: " << mp.size() << std::endl;
+	// newest tail
+	mp.erase(mp.lower_bound(N_KEYS - 100000), mp.end());
+	std::cout << "size: " << mp.size() << " last: " << (--mp.end())->first << std::endl;
+	for (ft_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->first ^ it->second;
+	std::cout << "checksum: " << sum << std::endl;
+	for (int i = 0; i < 1000; ++i)
+		mp.insert(_pair<const T1, T2>(i * 3, i));
+	std::cout << "size: " << mp.size() << " begin: " << mp.begin()->first << std::endl;
+	// everything
+	mp.erase(mp.begin(), mp.end());
+	std::cout << "size: " << mp.size() << " empty: " << mp.empty() << std::endl;
+	return (0);
+}
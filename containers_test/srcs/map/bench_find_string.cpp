@@ -0,0 +1,57 @@
+#include "common.hpp"
+#include <cstdio>
+
+// Benchmark: string keyed table queried with a (pointer, length) view, through a transparent
+// comparator : ft compares the view as is, no std::string is built per lookup.
+// Compare FT_TIME against STD_TIME.
+
+#define N_KEYS 100000
+#define N_QUERIES 1000000
+
+struct str_view
+{
+	const char	*p;
+	size_t		n;
+
+	str_view(const char *p, size_t n) : p(p), n(n) {}
+	operator std::string() const { return std::string(p, n); }
+};
+
+struct str_less
+{
+	typedef void is_transparent;
+
+	bool operator()(const std::string &a, const std::string &b) const { return a < b; }
+	bool operator()(const std::string &a, const str_view &b) const { return a.compare(0, a.size(), b.p, b.n) < 0; }
+	bool operator()(const str_view &a, const std::string &b) const { return b.compare(0, b.size(), a.p, a.n) > 0; }
+};
+
+typedef TESTED_NAMESPACE::map<std::string, int, str_less> str_map;
+
+int		main(void)
+{
+	str_map mp;
+	char buf[64];
+	long sum = 0;
+
+	// long enough keys that std::string cannot keep them inline
+	for (int i = 0; i < N_KEYS; ++i)
+	{
+		sprintf(buf, "/api/v1/routing/table/entry/%08d", i * 2);
+		mp[buf] = i;
+	}
+	std::cout << "size: " << mp.size() << std::endl;
+
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		int len = sprintf(buf, "/api/v1/routing/table/entry/%08d", (int)(((long)i * 7919) % (N_KEYS * 2)));
+		str_view key(buf, len);
+		str_map::iterator it = mp.find(key);
+		if (it != mp.end())
+			sum += it->second;
+		else
+			sum -= mp.count(key);
+	}
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
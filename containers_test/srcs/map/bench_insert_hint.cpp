@@ -0,0 +1,37 @@
+#include "common.hpp"
+
+// Benchmark: sorted append, with end() as hint and without hint.
+// A correct hint must not cost a full descent.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 500000
+
+typedef TESTED_NAMESPACE::map<T1, T2>::iterator ft_iterator;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> hinted;
+	TESTED_NAMESPACE::map<T1, T2> plain;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		hinted.insert(hinted.end(), _pair<const T1, T2>(i, i * 2));
+	for (int i = 0; i < N_KEYS; ++i)
+		plain.insert(_pair<const T1, T2>(i, i * 2));
+	std::cout << "size: " << hinted.size() << " / " << plain.size() << std::endl;
+	std::cout << "equal: " << (hinted == plain) << std::endl;
+
+	// hint on the element right after the inserted key
+	TESTED_NAMESPACE::map<T1, T2> backward;
+	ft_iterator hint = backward.end();
+	for (int i = N_KEYS; i > 0; --i)
+		hint = backward.insert(hint, _pair<const T1, T2>(i, i));
+	// hint on an existing key
+	for (int i = 0; i < 10; ++i)
+		sum += backward.insert(backward.find(i + 1), _pair<const T1, T2>(i + 1, 0))->second;
+	std::cout << "backward size: " << backward.size() << " begin: " << backward.begin()->first << std::endl;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
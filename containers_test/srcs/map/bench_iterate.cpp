@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+// Benchmark: full-range walks over a 10^6 entries map, by value iterators.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+#define N_PASSES 10
+
+typedef TESTED_NAMESPACE::map<T1, T2>::iterator ft_iterator;
+typedef TESTED_NAMESPACE::map<T1, T2>::const_reverse_iterator ft_const_rev_iterator;
+
+// iterators passed and returned by value
+static ft_iterator	next_odd(ft_iterator it, ft_iterator end)
+{
+	while (it != end && !(it->second & 1))
+		++it;
+	return (it);
+}
+
+int		main(void)
+{
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(mp.end(), _pair<const T1, T2>(i, i % 97));
+
+	for (int pass = 0; pass < N_PASSES; ++pass)
+	{
+		for (ft_iterator it = mp.begin(); it != mp.end(); ++it)
+			sum += it->second;
+		for (ft_iterator it = next_odd(mp.begin(), mp.end()); it != mp.end(); it = next_odd(++it, mp.end()))
+			++sum;
+	}
+	std::cout << "forward checksum: " << sum << std::endl;
+
+	sum = 0;
+	const TESTED_NAMESPACE::map<T1, T2> &c_mp = mp;
+	for (ft_const_rev_iterator it = c_mp.rbegin(); it != c_mp.rend(); ++it)
+		sum += it->first - it->second;
+	std::cout << "reverse checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,64 @@
+#include "common.hpp"
+
+// Benchmark: a 10^6 key map cut into 16 shards by key range and merged back, 10 times.
+// ft::map relinks subtrees (split / merge, O(log n) per cut),
+// std::map has to copy every element into the shard and erase it from the source.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+#define N_SHARDS 16
+#define N_ROUNDS 10
+
+#if !defined(USING_STD)
+// with the subtree sizes a cut doesn't count the shard
+typedef ft::map<T1, T2, std::less<T1>, std::allocator<ft::pair<const T1, T2> >, ft::order_statistics> map_type;
+#else
+typedef std::map<T1, T2> map_type;
+#endif
+
+#if !defined(USING_STD)
+void	split(map_type &mp, T1 k, map_type &x) { mp.split(k, x); }
+void	merge(map_type &mp, map_type &x) { mp.merge(x); }
+#else
+void	split(map_type &mp, T1 k, map_type &x)
+{
+	x.clear();
+	x.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+void	merge(map_type &mp, map_type &x)
+{
+	mp.insert(x.begin(), x.end());
+	x.clear();
+}
+#endif
+
+int		main(void)
+{
+	map_type mp;
+	map_type shards[N_SHARDS];
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		mp.insert(_pair<const T1, T2>((int)(((long)i * 7919) % N_KEYS), i));
+
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		// the shard boundaries move every round
+		int step = N_KEYS / N_SHARDS;
+		for (int s = N_SHARDS - 1; s > 0; --s)
+			split(mp, s * step + (r * 997) % step, shards[s]);
+		for (int s = 1; s < N_SHARDS; ++s)
+		{
+			sum += shards[s].size();
+			sum += shards[s].begin()->second;
+		}
+		for (int s = 1; s < N_SHARDS; ++s)
+			merge(mp, shards[s]);
+	}
+	std::cout << "size: " << mp.size() << std::endl;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,47 @@
+#include "common.hpp"
+#include <vector>
+
+// Benchmark: building maps from already sorted ranges (10^6 entries),
+// and from an unsorted range for comparison.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define T2 int
+#define N_KEYS 1000000
+
+typedef _pair<T1, T2> T3;
+typedef TESTED_NAMESPACE::map<T1, T2>::const_iterator ft_const_iterator;
+
+int		main(void)
+{
+	std::vector<T3> sorted;
+	std::vector<T3> shuffled;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		sorted.push_back(T3(i, i % 13));
+	for (int i = 0; i < N_KEYS / 10; ++i)
+		shuffled.push_back(T3((int)(((long)i * 7919) % N_KEYS), i));
+
+	// sorted dump
+	TESTED_NAMESPACE::map<T1, T2> mp(sorted.begin(), sorted.end());
+	// sorted map range
+	TESTED_NAMESPACE::map<T1, T2> mp2(mp.begin(), mp.end());
+	// sorted with duplicated keys : first one is kept
+	sorted.insert(sorted.begin() + 10, T3(9, 42));
+	TESTED_NAMESPACE::map<T1, T2> mp3(sorted.begin(), sorted.end());
+	// unsorted
+	TESTED_NAMESPACE::map<T1, T2> mp4(shuffled.begin(), shuffled.end());
+	// range insert into an empty map
+	TESTED_NAMESPACE::map<T1, T2> mp5;
+	mp5.insert(mp4.begin(), mp4.end());
+
+	std::cout << "sizes: " << mp.size() << " " << mp2.size() << " " << mp3.size()
+		<< " " << mp4.size() << " " << mp5.size() << std::endl;
+	std::cout << "equal: " << (mp == mp2) << " " << (mp == mp3) << " " << (mp4 == mp5) << std::endl;
+	std::cout << "mp3[9]: " << mp3[9] << std::endl;
+	for (ft_const_iterator it = mp4.begin(); it != mp4.end(); ++it)
+		sum += it->first ^ it->second;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
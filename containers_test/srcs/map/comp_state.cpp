@@ -0,0 +1,34 @@
+#include "common.hpp"
+
+// stateful comparator : key_comp() / value_comp() must be the one the map orders with
+struct Order
+{
+	bool reverse;
+
+	Order(bool r = false) : reverse(r) {}
+	bool operator()(int a, int b) const { return reverse ? b < a : a < b; }
+};
+
+typedef TESTED_NAMESPACE::map<int, int, Order> _map;
+
+int		main(void)
+{
+	_map	mp(Order(true));
+
+	for (int i = 0; i < 5; ++i)
+		mp[i * 10] = i;
+	printSize(mp);
+
+	_map::key_compare kc = mp.key_comp();
+	_map::value_compare vc = mp.value_comp();
+	std::cout << "reverse: " << kc.reverse << std::endl;
+	for (_map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+	{
+		_map::const_iterator next = it;
+		if (++next == mp.end())
+			break ;
+		std::cout << it->first << " < " << next->first << ": key_comp " << kc(it->first, next->first)
+			<< " | value_comp " << vc(*it, *next) << std::endl;
+	}
+	return (0);
+}
@@ -0,0 +1,68 @@
+#include "common.hpp"
+#include <list>
+
+// Each element must be copied once into its node, never through a temporary node.
+
+class counted
+{
+	public:
+		static int	copies;
+
+		counted(void) : _v(0) {}
+		counted(int v) : _v(v) {}
+		counted(const counted &src) : _v(src._v) { ++copies; }
+		counted &operator=(const counted &src) { _v = src._v; ++copies; return *this; }
+		~counted(void) {}
+		int	get(void) const { return _v; }
+	private:
+		int	_v;
+};
+
+int counted::copies = 0;
+
+#define T1 int
+#define T2 counted
+typedef TESTED_NAMESPACE::map<T1, T2>::value_type T3;
+
+static void	report(const std::string &what, int n)
+{
+	std::cout << what << ": " << counted::copies << " copies for " << n << " elements" << std::endl;
+	counted::copies = 0;
+}
+
+int		main(void)
+{
+	std::list<T3> lst;
+	const int n = 100;
+
+	for (int i = 0; i < n; ++i)
+		lst.push_back(T3(i, counted(i)));
+	counted::copies = 0;
+
+	TESTED_NAMESPACE::map<T1, T2> mp;
+	for (std::list<T3>::const_iterator it = lst.begin(); it != lst.end(); ++it)
+		mp.insert(*it);
+	report("insert", n);
+
+	for (std::list<T3>::const_iterator it = lst.begin(); it != lst.end(); ++it)
+		mp.insert(*it);
+	report("insert existing", n);
+
+	TESTED_NAMESPACE::map<T1, T2> mp2;
+	for (std::list<T3>::const_iterator it = lst.begin(); it != lst.end(); ++it)
+		mp2.insert(mp2.end(), *it);
+	report("insert with hint", n);
+
+	TESTED_NAMESPACE::map<T1, T2> mp3(lst.begin(), lst.end());
+	report("range constructor", n);
+
+	TESTED_NAMESPACE::map<T1, T2> mp4(mp3);
+	report("copy constructor", n);
+
+	int sum = 0;
+	for (int i = 0; i < n; ++i)
+		sum += mp4[i].get();
+	report("operator[] existing", n);
+	std::cout << "sum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+#include <cstring>
+
+// Lookups with a const char * on a map<std::string, int> whose comparator is transparent.
+
+struct str_less
+{
+	typedef void is_transparent;
+
+	bool operator()(const std::string &a, const std::string &b) const { return a < b; }
+	bool operator()(const std::string &a, const char *b) const { return a.compare(b) < 0; }
+	bool operator()(const char *a, const std::string &b) const { return b.compare(a) > 0; }
+};
+
+typedef TESTED_NAMESPACE::map<std::string, int, str_less> str_map;
+
+int		main(void)
+{
+	str_map mp;
+	const char *keys[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur"};
+	const char *queries[] = {"dolor", "amet", "a", "zzz", "sit", "ipsum dolor"};
+
+	for (int i = 0; i < 6; ++i)
+		mp[keys[i]] = i;
+	printSize(mp);
+
+	const str_map &c_mp = mp;
+	for (int i = 0; i < 6; ++i)
+	{
+		const char *q = queries[i];
+		str_map::iterator it = mp.find(q);
+		str_map::const_iterator lo = c_mp.lower_bound(q);
+		str_map::iterator up = mp.upper_bound(q);
+		_pair<str_map::const_iterator, str_map::const_iterator> range = c_mp.equal_range(q);
+
+		std::cout << "[" << q << "] count: " << mp.count(q);
+		std::cout << " | find: " << (it == mp.end() ? "end" : it->first);
+		std::cout << " | lower: " << (lo == c_mp.end() ? "end" : lo->first);
+		std::cout << " | upper: " << (up == mp.end() ? "end" : up->first);
+		std::cout << " | equal: " << (range.first == lo) << (range.second == str_map::const_iterator(up));
+		std::cout << std::endl;
+	}
+	return (0);
+}
@@ -0,0 +1,82 @@
+#include "common.hpp"
+#include <iterator>
+
+// find_by_order / order_of_key and iterator +/- n.
+// std::map has none of them : the reference side walks the tree in O(n).
+
+#define T1 int
+#define T2 std::string
+
+#if !defined(USING_STD)
+// the subtree sizes are opt-in
+typedef ft::map<T1, T2, std::less<T1>, std::allocator<ft::pair<const T1, T2> >, ft::order_statistics> map_type;
+#else
+typedef std::map<T1, T2> map_type;
+#endif
+typedef map_type::iterator iterator;
+typedef map_type::const_iterator const_iterator;
+
+#if !defined(USING_STD)
+iterator	by_order(map_type &mp, std::size_t k) { return mp.find_by_order(k); }
+std::size_t	of_key(const map_type &mp, T1 k) { return mp.order_of_key(k); }
+iterator	jump(iterator it, long n) { return it + n; }
+long		dist(const_iterator first, const_iterator last) { return last - first; }
+#else
+iterator	by_order(map_type &mp, std::size_t k)
+{
+	iterator it = mp.begin();
+	for (; k && it != mp.end(); --k)
+		++it;
+	return it;
+}
+std::size_t	of_key(const map_type &mp, T1 k) { return std::distance(mp.begin(), mp.lower_bound(k)); }
+iterator	jump(iterator it, long n) { std::advance(it, n); return it; }
+long		dist(const_iterator first, const_iterator last) { return std::distance(first, last); }
+#endif
+
+void	print_order(map_type &mp)
+{
+	for (std::size_t k = 0; k <= mp.size(); k += 3)
+	{
+		iterator it = by_order(mp, k);
+		std::cout << "[" << k << "] " << (it == mp.end() ? "end" : it->second) << std::endl;
+	}
+	for (T1 key = -5; key < 60; key += 7)
+		std::cout << "order_of_key(" << key << "): " << of_key(mp, key) << std::endl;
+	std::cout << "distance: " << dist(mp.begin(), mp.end()) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+int		main(void)
+{
+	map_type mp;
+
+	for (int i = 0; i < 20; ++i)
+		mp[(i * 7) % 50] = std::string(1, 'a' + i);
+	print_order(mp);
+
+	// sizes have to follow the rebalancing of erase and range erase
+	mp.erase(14);
+	mp.erase(mp.begin());
+	mp.erase(mp.lower_bound(20), mp.lower_bound(40));
+	print_order(mp);
+
+	map_type copy(mp);
+	for (int i = 100; i < 130; ++i)
+		copy[i] = "z";
+	print_order(copy);
+
+	iterator it = jump(copy.begin(), 5);
+	std::cout << "begin + 5: " << it->first << std::endl;
+	it = jump(it, 17);
+	std::cout << "+ 17: " << it->first << std::endl;
+	it = jump(it, -20);
+	std::cout << "- 20: " << it->first << std::endl;
+	std::cout << "end - 1: " << jump(copy.end(), -1)->first << std::endl;
+	std::cout << "distance: " << dist(it, copy.end()) << " " << dist(copy.begin(), it) << std::endl;
+
+	// bulk build from a sorted range
+	map_type built(copy.begin(), copy.end());
+	print_order(built);
+	return (0);
+}
@@ -0,0 +1,71 @@
+#include "common.hpp"
+
+// split(k, x) / merge(x). std::map (C++98) has neither :
+// the reference side copies the range and erases it.
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> map_type;
+
+#if !defined(USING_STD)
+void	split(map_type &mp, T1 k, map_type &x) { mp.split(k, x); }
+void	merge(map_type &mp, map_type &x) { mp.merge(x); }
+#else
+void	split(map_type &mp, T1 k, map_type &x)
+{
+	x.clear();
+	x.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+void	merge(map_type &mp, map_type &x)
+{
+	// elements whose key is already in mp stay in x
+	for (map_type::iterator it = x.begin(); it != x.end(); )
+	{
+		if (mp.insert(*it).second)
+			x.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+int		main(void)
+{
+	map_type mp, right;
+
+	for (int i = 0; i < 30; ++i)
+		mp[(i * 7) % 60] = std::string(1, 'a' + (i % 26));
+	right[100] = "old";
+
+	split(mp, 25, right);
+	printSize(mp);
+	printSize(right);
+
+	// split at the extremes
+	map_type empty;
+	split(right, 1000, empty);
+	printSize(empty);
+	split(right, -1, empty);
+	printSize(right);
+	printSize(empty);
+
+	// disjoint key ranges : a single join
+	merge(mp, empty);
+	printSize(mp);
+	printSize(empty);
+
+	// interleaved keys, the duplicates stay behind
+	map_type other;
+	for (int i = 0; i < 20; ++i)
+		other[i * 3] = "other";
+	merge(mp, other);
+	printSize(mp);
+	printSize(other);
+
+	// the iterators of both maps still walk in order
+	printReverse(mp);
+	std::cout << "lower_bound(40): " << mp.lower_bound(40)->first << std::endl;
+	return (0);
+}
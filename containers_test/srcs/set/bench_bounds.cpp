@@ -0,0 +1,35 @@
+#include "common.hpp"
+
+// Benchmark: 10^6 keys, range queries must descend the tree (O(log n)).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define N_KEYS 1000000
+#define N_QUERIES 100000
+
+typedef TESTED_NAMESPACE::set<T1>::iterator ft_iterator;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::set<T1> st;
+	long sum = 0;
+
+	// even keys only, so half the queries fall between two keys
+	for (int i = 0; i < N_KEYS; ++i)
+		st.insert(i * 2);
+	std::cout << "size: " << st.size() << std::endl;
+
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		T1 key = (int)(((long)i * 7919) % (N_KEYS * 2 + 2)) - 1;
+		ft_iterator lo = st.lower_bound(key);
+		ft_iterator up = st.upper_bound(key);
+		_pair<ft_iterator, ft_iterator> range = st.equal_range(key);
+
+		sum += (lo == st.end()) ? -1 : *lo;
+		sum += (up == st.end()) ? -1 : *up;
+		sum += (range.first == lo && range.second == up);
+	}
+	std::cout << "bounds checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,25 @@
+#include "common.hpp"
+
+// Benchmark: membership tests with count(), one descent per call (O(log n)).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#ifndef N_KEYS
+# define N_KEYS 100000
+#endif
+#define N_QUERIES 1000000
+
+int		main(void)
+{
+	TESTED_NAMESPACE::set<T1> st;
+	long hits = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		st.insert(i * 3);
+	std::cout << "size: " << st.size() << std::endl;
+
+	for (int i = 0; i < N_QUERIES; ++i)
+		hits += st.count((int)(((long)i * 7919) % (N_KEYS * 3)));
+	std::cout << "count hits: " << hits << std::endl;
+	return (0);
+}
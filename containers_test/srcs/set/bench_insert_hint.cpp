@@ -0,0 +1,23 @@
+#include "common.hpp"
+
+// Benchmark: sorted append, with end() as hint and without hint.
+// A correct hint must not cost a full descent.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define T1 int
+#define N_KEYS 500000
+
+int		main(void)
+{
+	TESTED_NAMESPACE::set<T1> hinted;
+	TESTED_NAMESPACE::set<T1> plain;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		hinted.insert(hinted.end(), i);
+	for (int i = 0; i < N_KEYS; ++i)
+		plain.insert(i);
+	std::cout << "size: " << hinted.size() << " / " << plain.size() << std::endl;
+	std::cout << "equal: " << (hinted == plain) << std::endl;
+	std::cout << "last: " << *hinted.rbegin() << std::endl;
+	return (0);
+}
@@ -0,0 +1,52 @@
+#include "common.hpp"
+#include <iterator>
+
+// Benchmark: percentiles and ranks over 10^5 live keys.
+// ft::set answers both in O(log n) (find_by_order / order_of_key),
+// std::set has to walk from begin() : O(n) per query.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define N_KEYS 100000
+#define N_QUERIES 1000
+
+#if !defined(USING_STD)
+typedef ft::set<int, std::less<int>, std::allocator<int>, ft::order_statistics> set_type;
+#else
+typedef std::set<int> set_type;
+#endif
+typedef set_type::const_iterator const_iterator;
+
+#if !defined(USING_STD)
+const_iterator	by_order(const set_type &st, std::size_t k) { return st.find_by_order(k); }
+std::size_t		of_key(const set_type &st, int k) { return st.order_of_key(k); }
+#else
+const_iterator	by_order(const set_type &st, std::size_t k)
+{
+	const_iterator it = st.begin();
+	std::advance(it, k);
+	return it;
+}
+std::size_t		of_key(const set_type &st, int k) { return std::distance(st.begin(), st.lower_bound(k)); }
+#endif
+
+int		main(void)
+{
+	set_type st;
+	long sum = 0;
+
+	for (int i = 0; i < N_KEYS; ++i)
+		st.insert((int)(((long)i * 7919) % (N_KEYS * 3)));
+	std::cout << "size: " << st.size() << std::endl;
+
+	// the set changes between queries : nothing can be precomputed
+	for (int i = 0; i < N_QUERIES; ++i)
+	{
+		st.insert(i * 3 + 1);
+		st.erase((int)(((long)i * 104729) % (N_KEYS * 3)));
+		sum += *by_order(st, st.size() * (i % 100) / 100);
+		sum += of_key(st, (int)(((long)i * 15485863) % (N_KEYS * 3)));
+	}
+	std::cout << "size: " << st.size() << std::endl;
+	std::cout << "checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,41 @@
+#include "common.hpp"
+
+// Lookups with a const char * on a set<std::string> whose comparator is transparent.
+
+struct str_less
+{
+	typedef void is_transparent;
+
+	bool operator()(const std::string &a, const std::string &b) const { return a < b; }
+	bool operator()(const std::string &a, const char *b) const { return a.compare(b) < 0; }
+	bool operator()(const char *a, const std::string &b) const { return b.compare(a) > 0; }
+};
+
+typedef TESTED_NAMESPACE::set<std::string, str_less> str_set;
+
+int		main(void)
+{
+	str_set st;
+	const char *keys[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur"};
+	const char *queries[] = {"dolor", "amet", "a", "zzz", "sit", "ipsum dolor"};
+
+	for (int i = 0; i < 6; ++i)
+		st.insert(keys[i]);
+
+	for (int i = 0; i < 6; ++i)
+	{
+		const char *q = queries[i];
+		str_set::iterator it = st.find(q);
+		str_set::iterator lo = st.lower_bound(q);
+		str_set::iterator up = st.upper_bound(q);
+		_pair<str_set::iterator, str_set::iterator> range = st.equal_range(q);
+
+		std::cout << "[" << q << "] count: " << st.count(q);
+		std::cout << " | find: " << (it == st.end() ? "end" : *it);
+		std::cout << " | lower: " << (lo == st.end() ? "end" : *lo);
+		std::cout << " | upper: " << (up == st.end() ? "end" : *up);
+		std::cout << " | equal: " << (range.first == lo) << (range.second == up);
+		std::cout << std::endl;
+	}
+	return (0);
+}
@@ -0,0 +1,39 @@
+#include "common.hpp"
+#include <sstream>
+#include <iterator>
+
+#define T1 int
+
+// single-pass input : std::istream_iterator can only be read once
+static void	from_stream(const std::string &str)
+{
+	std::istringstream in(str);
+	std::istream_iterator<T1> first(in);
+	std::istream_iterator<T1> last;
+
+	TESTED_NAMESPACE::set<T1> st(first, last);
+	printSize(st);
+}
+
+static void	insert_stream(TESTED_NAMESPACE::set<T1> &st, const std::string &str)
+{
+	std::istringstream in(str);
+	std::istream_iterator<T1> first(in);
+	std::istream_iterator<T1> last;
+
+	st.insert(first, last);
+	printSize(st);
+}
+
+int		main(void)
+{
+	from_stream("10 20 30 40 50");
+	from_stream("50 10 40 20 30");
+	from_stream("10 10 20 20 30");
+	from_stream("");
+
+	TESTED_NAMESPACE::set<T1> st;
+	insert_stream(st, "1 2 3 4");
+	insert_stream(st, "8 2 6 5 7");
+	return (0);
+}
@@ -0,0 +1,73 @@
+#include "common.hpp"
+#include <cstdlib>
+
+// Benchmark: push_back growth and explicit reserve() steps, counting the bytes
+// requested from operator new.
+// push_back grows geometrically; reserve(n) has to allocate exactly n, even right after
+// a previous reserve (a pre-sized buffer grown by 10% must not end up twice as big).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define TESTED_TYPE int
+#define N_ELEMS 1000000
+#define N_ROUNDS 20
+#define N_BUFFERS 64
+
+static std::size_t g_new_bytes = 0;
+static std::size_t g_new_calls = 0;
+
+void	*operator new(std::size_t size)
+{
+	g_new_bytes += size;
+	++g_new_calls;
+	void *p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void	operator delete(void *p) throw()
+{
+	std::free(p);
+}
+
+int		main(void)
+{
+	long sum = 0;
+
+	// geometric growth : a handful of reallocations for 10^6 push_back
+	g_new_calls = 0;
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		TESTED_NAMESPACE::vector<TESTED_TYPE> vct;
+		for (int i = 0; i < N_ELEMS; ++i)
+			vct.push_back(i);
+		sum += vct.back() + vct.size();
+	}
+	std::cout << "push_back checksum: " << sum << std::endl;
+	std::cout << "at most 64 allocations per vector: " << (g_new_calls <= N_ROUNDS * 64) << std::endl;
+
+	// pre-sized buffers, each grown three times by 10% with an explicit reserve
+	std::size_t wanted = 0;
+	bool exact = true;
+	g_new_bytes = 0;
+	for (int b = 0; b < N_BUFFERS; ++b)
+	{
+		TESTED_NAMESPACE::vector<TESTED_TYPE> vct;
+		std::size_t n = 10000 + b * 1000;
+
+		for (int step = 0; step < 4; ++step)
+		{
+			vct.reserve(n);
+			wanted += n;
+			exact = exact && (vct.capacity() == n);
+			while (vct.size() < n)
+				vct.push_back((int)vct.size());
+			n += n / 10;
+		}
+		sum += vct[vct.size() / 2];
+	}
+	std::cout << "reserve checksum: " << sum << std::endl;
+	std::cout << "reserve(n) gives capacity n: " << exact << std::endl;
+	std::cout << "bytes requested == bytes reserved: " << (g_new_bytes == wanted * sizeof(TESTED_TYPE)) << std::endl;
+	return (0);
+}
@@ -0,0 +1,62 @@
+#include "common.hpp"
+#include "realloc_allocator.hpp"
+
+// Benchmark: push_back growth of vector<int> and vector<Buffer> (main.cpp's 4 KiB POD)
+// with ft::realloc_allocator (used by both namespaces).
+// ft::vector grows the block with reallocate() (realloc / mremap for large blocks),
+// std::vector allocates a new block and copies at every growth.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define N_INTS 10000000
+#define N_BUFFERS 16384
+#define N_ROUNDS 4
+#define BUFFER_SIZE 4096
+
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+#if !defined(USING_STD)
+namespace ft
+{
+	template <>
+	struct is_trivially_copyable<Buffer>
+	{
+		static const bool value = true;
+	};
+}
+#endif
+
+template <typename T>
+long	idx(const T &x) { return x; }
+long	idx(const Buffer &x) { return x.idx + x.buff[x.idx % BUFFER_SIZE]; }
+
+template <typename T>
+long	grow(const T &value, std::size_t n)
+{
+	long sum = 0;
+
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		TESTED_NAMESPACE::vector<T, ft::realloc_allocator<T> > vct;
+
+		for (std::size_t i = 0; i < n; ++i)
+			vct.push_back(value);
+		sum += vct.size() + idx(vct[n / 3]) + idx(vct.back());
+	}
+	return sum;
+}
+
+int		main(void)
+{
+	Buffer buffer;
+
+	buffer.idx = 5;
+	for (int b = 0; b < BUFFER_SIZE; ++b)
+		buffer.buff[b] = (char)b;
+	std::cout << "vector<int> checksum: " << grow(42, N_INTS) << std::endl;
+	std::cout << "vector<Buffer> checksum: " << grow(buffer, N_BUFFERS) << std::endl;
+	return (0);
+}
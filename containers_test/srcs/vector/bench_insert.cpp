@@ -0,0 +1,57 @@
+#include "common.hpp"
+
+// Benchmark: inserts and erases in the middle of vector<int> (10^6 elements)
+// and vector<std::string>. Every call moves half of the vector : one memmove for
+// relocatable types, otherwise copies past end() plus assignments within the live range.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define N_INTS 1000000
+#define N_STRINGS 20000
+#define N_OPS 200
+
+template <typename T>
+long	idx(const T &x) { return x; }
+long	idx(const std::string &x) { return x.size() + x[0]; }
+
+template <typename T>
+long	run(const T *values, std::size_t n)
+{
+	TESTED_NAMESPACE::vector<T> vct;
+	TESTED_NAMESPACE::vector<T> small(values, values + 8);
+	long sum = 0;
+
+	for (std::size_t i = 0; i < n; ++i)
+		vct.push_back(values[i % 64]);
+	for (int k = 0; k < N_OPS; ++k)
+	{
+		std::size_t mid = vct.size() / 2;
+
+		vct.insert(vct.begin() + mid, values[k % 64]);
+		vct.insert(vct.begin() + mid - k, 3, values[(k + 1) % 64]);
+		vct.insert(vct.begin() + mid + k, small.begin(), small.end());
+		sum += idx(vct[mid + k]) + idx(vct[mid - k]);
+		vct.erase(vct.begin() + mid - 2 * k, vct.begin() + mid - 2 * k + 10);
+		sum += vct.size() + idx(vct[mid]);
+	}
+	// a tail shorter than the insertion : part copied past end(), part assigned
+	vct.insert(vct.end() - 4, small.begin(), small.end());
+	vct.insert(vct.end() - 2, 5, values[1]);
+	for (std::size_t i = vct.size() - 16; i < vct.size(); ++i)
+		sum += idx(vct[i]);
+	return sum + vct.size();
+}
+
+int		main(void)
+{
+	int ints[64];
+	std::string strings[64];
+
+	for (int i = 0; i < 64; ++i)
+	{
+		ints[i] = i * 7;
+		strings[i] = std::string(i % 5 == 0 ? 40 : i % 8 + 1, (char)('a' + i % 26));
+	}
+	std::cout << "vector<int> checksum: " << run(ints, N_INTS) << std::endl;
+	std::cout << "vector<std::string> checksum: " << run(strings, N_STRINGS) << std::endl;
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+// Benchmark: full-range walks over a 10^6 elements vector, by value iterators.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define TESTED_TYPE int
+#define N_ELEMS 1000000
+#define N_PASSES 50
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE>::iterator ft_iterator;
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE>::const_reverse_iterator ft_const_rev_iterator;
+
+// iterators passed and returned by value
+static ft_iterator	next_odd(ft_iterator it, ft_iterator end)
+{
+	while (it != end && !(*it & 1))
+		++it;
+	return (it);
+}
+
+int		main(void)
+{
+	TESTED_NAMESPACE::vector<TESTED_TYPE> vct(N_ELEMS);
+	long sum = 0;
+
+	for (int i = 0; i < N_ELEMS; ++i)
+		vct[i] = i % 97;
+
+	for (int pass = 0; pass < N_PASSES; ++pass)
+	{
+		for (ft_iterator it = vct.begin(); it != vct.end(); ++it)
+			sum += *it;
+		for (ft_iterator it = next_odd(vct.begin(), vct.end()); it != vct.end(); it = next_odd(++it, vct.end()))
+			++sum;
+	}
+	std::cout << "forward checksum: " << sum << std::endl;
+
+	sum = 0;
+	const TESTED_NAMESPACE::vector<TESTED_TYPE> &c_vct = vct;
+	for (ft_const_rev_iterator it = c_vct.rbegin(); it != c_vct.rend(); ++it)
+		sum += *it;
+	std::cout << "reverse checksum: " << sum << std::endl;
+	return (0);
+}
@@ -0,0 +1,71 @@
+#include "common.hpp"
+#include <cstring>
+
+// Benchmark: reallocations of vectors whose elements own heap memory.
+// Handle opts in to ft::is_trivially_relocatable : growing a vector<Handle> is one memcpy,
+// the copy + destroy pair (an allocation and a free per element) is skipped.
+// std::string takes the same path only where its layout allows it (see type_trait.hpp).
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define N_ELEMS 200000
+#define N_ROUNDS 10
+
+class Handle
+{
+	public:
+		Handle(const char *s = "") : _len(std::strlen(s)), _data(new char[_len + 1]) { std::memcpy(_data, s, _len + 1); }
+		Handle(const Handle &x) : _len(x._len), _data(new char[_len + 1]) { std::memcpy(_data, x._data, _len + 1); }
+		~Handle() { delete[] _data; }
+		Handle &operator=(const Handle &x)
+		{
+			Handle tmp(x);
+			std::swap(_len, tmp._len);
+			std::swap(_data, tmp._data);
+			return *this;
+		}
+		std::size_t size() const { return _len; }
+		char operator[](std::size_t i) const { return _data[i]; }
+
+	private:
+		std::size_t	_len;
+		char		*_data;	// owned, never points into the Handle itself
+};
+
+#if !defined(USING_STD)
+namespace ft
+{
+	template <>
+	struct is_trivially_relocatable<Handle>
+	{
+		static const bool value = true;
+	};
+}
+#endif
+
+template <typename T>
+long	grow(const char *text)
+{
+	long sum = 0;
+
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		TESTED_NAMESPACE::vector<T> vct;
+
+		// geometric growth, then explicit reserves : every step reallocates
+		for (int i = 0; i < N_ELEMS; ++i)
+			vct.push_back(T(text + (i % 16)));
+		for (int k = 1; k <= 4; ++k)
+			vct.reserve(vct.capacity() + k);
+		sum += vct.size() + vct[r].size() + vct[N_ELEMS - 1][0];
+	}
+	return sum;
+}
+
+int		main(void)
+{
+	const char *text = "relocation is a memcpy when nothing points into the object";
+
+	std::cout << "vector<Handle> checksum: " << grow<Handle>(text) << std::endl;
+	std::cout << "vector<std::string> checksum: " << grow<std::string>(text) << std::endl;
+	return (0);
+}
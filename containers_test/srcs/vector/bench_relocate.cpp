@@ -0,0 +1,77 @@
+#include "common.hpp"
+
+// Benchmark: element transfers of vector<int> and vector<Buffer> (a POD like main.cpp's) :
+// copy construction, operator=, reallocation by reserve(), front erase and insert.
+// For trivially copyable types these are single memcpy / memmove calls.
+// Compare FT_TIME against STD_TIME in the do.sh report.
+
+#define N_INTS 1000000
+#define N_BUFFERS 20000
+#define N_ROUNDS 20
+#define BUFFER_SIZE 256
+
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+#if !defined(USING_STD)
+// Buffer is a POD : opt in to the bulk copies
+namespace ft
+{
+	template <>
+	struct is_trivially_copyable<Buffer>
+	{
+		static const bool value = true;
+	};
+}
+#endif
+
+template <typename T>
+long	idx(const T &x) { return x; }
+long	idx(const Buffer &x) { return x.idx + x.buff[x.idx % BUFFER_SIZE]; }
+
+template <typename T>
+long	run(const T *values, std::size_t n)
+{
+	long sum = 0;
+
+	for (int r = 0; r < N_ROUNDS; ++r)
+	{
+		TESTED_NAMESPACE::vector<T> vct;
+		for (std::size_t i = 0; i < n; ++i)
+			vct.push_back(values[i % 64]);
+
+		TESTED_NAMESPACE::vector<T> copy(vct);
+		copy.reserve(copy.capacity() + 1);  // one more reallocation
+		vct = copy;
+		sum += idx(vct[n / 2]) + idx(copy[n - 1]);
+
+		// 8 erase / insert near the front : the whole tail moves each time
+		for (int k = 0; k < 8; ++k)
+		{
+			copy.erase(copy.begin() + k, copy.begin() + k + 4);
+			copy.insert(copy.begin() + k * 2, 3, values[k]);
+		}
+		sum += copy.size() + idx(copy[r]) + idx(copy.back());
+	}
+	return sum;
+}
+
+int		main(void)
+{
+	int ints[64];
+	Buffer buffers[64];
+
+	for (int i = 0; i < 64; ++i)
+	{
+		ints[i] = i * 7;
+		buffers[i].idx = i;
+		for (int b = 0; b < BUFFER_SIZE; ++b)
+			buffers[i].buff[b] = (char)(b + i);
+	}
+	std::cout << "vector<int> checksum: " << run(ints, N_INTS) << std::endl;
+	std::cout << "vector<Buffer> checksum: " << run(buffers, N_BUFFERS) << std::endl;
+	return (0);
+}